@@ -9,12 +9,13 @@
 #include <Wire.h>
 #include <WiFi.h>
 #include <PubSubClient.h>
-#include <StreamString.h>
 #include <Preferences.h>
 #include <WebServer.h>
 #include <Update.h>
 #include <DNSServer.h>
 #include <esp_task_wdt.h> // Watchdog Timer 리셋을 위해 추가
+#include <LittleFS.h>
+#include <time.h>
 
 
 
@@ -25,6 +26,22 @@
 #include "src/core/LEDs.h"
 #include "src/core/Timer100ms.h"
 #include "src/core/JsonOut.h"
+#include "src/core/Profiler.h"
+#include "src/core/Scheduler.h"
+#include "src/core/Telemetry.h"
+#include "src/core/TelemetryBin.h"
+#include "src/core/MsgPool.h"
+#include "src/core/FlashSpool.h"
+#include "src/core/WifiLink.h"
+#include "src/core/I2CBus.h"
+#include "src/core/WarmState.h"
+#include "src/core/Power.h"
+#include "src/core/CalCurve.h"
+#include "src/core/Deadband.h"
+#include "src/core/Rollup.h"
+#include "src/core/Metrics.h"
+#include "src/web/PortalAssets.h"
+#include "src/app/Jobs.h"   // 센서/발행 잡, 드라이버 전역, 메시지 풀 (호스트 벤치와 공용)
 
 // --- Project Drivers ---
 #include "src/drivers/ADS1115_Helper.h"
@@ -50,6 +67,8 @@
 #define DEFAULT_MQTT_HOST "192.168.0.186"
 #define DEFAULT_MQTT_PORT 1883
 #define DEFAULT_MQ2_R0    9000.0f
+#define DEFAULT_BATCH_K   1       // 1 = 샘플마다 단건 발행 (기존 형식)
+#define DEFAULT_BATCH_MS  5000
 
 
 // =================================================================
@@ -69,6 +88,8 @@ struct AppConfig {
 	char mqtt_pass[65];
 	float mq2_r0; // MQ-2 센서의 기준 저항(R0) 값
 	float smoke2_alpha; // SMOKE2 센서의 기준 값(alpha)
+	uint8_t batch_k;    // MQTT 묶음 발행: 최대 샘플 수 (1이면 묶지 않음)
+	uint16_t batch_ms;  // MQTT 묶음 발행: 첫 샘플 후 최대 대기 시간
 };
 
 AppConfig g_config; // 전역 설정 변수
@@ -91,6 +112,27 @@ void startConfigPortal();
 #ifndef MQTT_STATUS_TOPIC
 #define MQTT_STATUS_TOPIC "sensorhub/status"
 #endif
+#ifndef MQTT_LINK_TOPIC
+#define MQTT_LINK_TOPIC "sensorhub/status/link"   // 재연결 시 단절 통계
+#endif
+#ifndef MQTT_TOPIC_BIN
+#define MQTT_TOPIC_BIN "sensorhub/telemetry/bin"
+#endif
+// 단절 중 보관했던 레코드 재전송 토픽 (JSON은 배열, 바이너리는 레코드 연접)
+#ifndef MQTT_TOPIC_REPLAY
+#define MQTT_TOPIC_REPLAY "sensorhub/telemetry/replay"
+#endif
+#ifndef MQTT_TOPIC_BIN_REPLAY
+#define MQTT_TOPIC_BIN_REPLAY "sensorhub/telemetry/bin/replay"
+#endif
+// 구간 통계: MQTT_TOPIC_ROLLUP/<창> (예: sensorhub/rollup/1m), 재전송은 .../<창>/replay
+#ifndef MQTT_TOPIC_ROLLUP
+#define MQTT_TOPIC_ROLLUP "sensorhub/rollup"
+#endif
+// 운영 지표 (힙/스택/큐/잡 소요시간 히스토그램), 보관/재전송 없음
+#ifndef MQTT_METRICS_TOPIC
+#define MQTT_METRICS_TOPIC "sensorhub/metrics"
+#endif
 
 // 강제 설정 모드 진입을 위한 버튼 핀
 #define PIN_FORCE_CONFIG_PORTAL 1
@@ -99,83 +141,148 @@ void startConfigPortal();
 
 static WiFiClient g_net;
 static PubSubClient g_mqtt(g_net);
-static uint32_t g_lastConnMs = 0;
+static WifiLink g_wifi;                    // 비차단 Wi-Fi 재연결 상태 머신
+static Backoff g_mqttBackoff(1000, 30000); // 브로커 재접속 간격
+static uint32_t g_mqttRetryAt = 0;
+static uint32_t g_mqttDownSince = 0;
+static uint32_t g_mqttReconnects = 0;
 
 // FreeRTOS 핸들
 static TaskHandle_t g_sensorTaskHandle = NULL;
 static TaskHandle_t g_mqttTaskHandle = NULL;
-// 센서 Task -> MQTT Task로 JSON 문자열을 전달하기 위한 Queue
 static uint32_t g_buttonPressStartTime = 0;
 const uint32_t CONFIG_PORTAL_HOLD_TIME_MS = 5000; // 5 seconds
 
-static QueueHandle_t g_mqttQueue = NULL;
-// Queue에 저장할 메시지의 최대 길이
+// MQTT 패킷 버퍼 최대 길이
 #define MAX_JSON_MSG_SIZE 2048
 
+#if ENABLE_ROLLUP
+static char g_rollupTopic[ROLLUP_MAX][40];
+static char g_rollupReplayTopic[ROLLUP_MAX][48];
+
+// 창 길이 → 토픽 접미사 (3600 → "1h", 900 → "15m", 45 → "45s")
+static void rollup_topics_init(){
+	for (uint8_t k = 0; k < ROLLUP_COUNT; k++) {
+		uint32_t w = ROLLUP_WINDOWS[k];
+		char label[12];
+		if (w % 3600 == 0)    snprintf(label, sizeof(label), "%luh", (unsigned long)(w / 3600));
+		else if (w % 60 == 0) snprintf(label, sizeof(label), "%lum", (unsigned long)(w / 60));
+		else                  snprintf(label, sizeof(label), "%lus", (unsigned long)w);
+		snprintf(g_rollupTopic[k], sizeof(g_rollupTopic[k]), "%s/%s", MQTT_TOPIC_ROLLUP, label);
+		snprintf(g_rollupReplayTopic[k], sizeof(g_rollupReplayTopic[k]), "%s/replay", g_rollupTopic[k]);
+	}
+}
+#endif
 
-static void i2cInit(){ 
-	Wire.begin(PIN_I2C_SDA, PIN_I2C_SCL, I2C_FREQ_HZ); 
+
+// MQTT 묶음 발행 (g_config.batch_k > 1일 때)
+// 샘플 batch_k개가 모이거나, 첫 샘플 후 batch_ms가 지나거나, 경보 샘플이 오면 한 번에 발행합니다.
+// JSON은 배열([{...},{...}]), 바이너리는 레코드를 이어 붙여 같은 토픽으로 발행합니다.
+#define BATCH_K_MAX       20
+#define BATCH_MAX_BYTES   4096   // 묶음 크기 상한 (넘으면 그 전에 flush)
+
+static const char* topic_for_tag(uint8_t tag){
+	#if ENABLE_ROLLUP
+	if (tag >= MSG_ROLLUP && tag < MSG_ROLLUP + ROLLUP_COUNT) return g_rollupTopic[tag - MSG_ROLLUP];
+	#endif
+	switch(tag){
+		case MSG_TELEMETRY_BIN: return MQTT_TOPIC_BIN;
+		case MSG_METRICS:       return MQTT_METRICS_TOPIC;
+		default:                return MQTT_TOPIC;
+	}
 }
 
+static const char* replay_topic_for_tag(uint8_t tag){
+	#if ENABLE_ROLLUP
+	if (tag >= MSG_ROLLUP && tag < MSG_ROLLUP + ROLLUP_COUNT) return g_rollupReplayTopic[tag - MSG_ROLLUP];
+	#endif
+	switch(tag){
+		case MSG_TELEMETRY_BIN: return MQTT_TOPIC_BIN_REPLAY;
+		default:                return MQTT_TOPIC_REPLAY;
+	}
+}
 
-// Globals
-#if USE_ADS1115 || USE_CO_ADC
-	ADS1115_Helper ads;
+#if ENABLE_FLASH_SPOOL
+// 단절 중 레코드 보관 (LittleFS /spool, 최대 SPOOL_SEG_BYTES * SPOOL_MAX_SEGS)
+// 재연결 후에는 REPLAY_INTERVAL_MS마다 최대 REPLAY_MAX_BYTES씩만 재전송하여 링크 포화를 막습니다.
+#define SPOOL_SEG_BYTES      (64 * 1024)
+#define SPOOL_MAX_SEGS       16
+#define REPLAY_BATCH         20
+#define REPLAY_MAX_BYTES     4096
+#define REPLAY_INTERVAL_MS   500
+#define SPOOL_F_HAS_TS       0x01   // 페이로드에 이미 ts가 들어 있음
+
+static FlashSpool g_spool;
 #endif
+static uint32_t g_bootId = 0;   // 부팅 세션 식별자 (재전송 시 uptime → epoch 환산 가능 여부 판단)
 
-#if USE_MQ2
-	MQ2 mq2; MQ2Config mq2cfg;
-#endif
 
-#if USE_ZE07
-	ZE07 ze07;
-	HardwareSerial CO_SER(2);
-#endif
+// 공유 버스: 드라이버가 i2cbus::Guard로 Task 간 직렬화 + 장치별 클럭 전환
+static void i2cInit(){ 
+	i2cbus::begin(Wire, PIN_I2C_SDA, PIN_I2C_SCL, I2C_FREQ_HZ); 
+}
 
-#if USE_SEN0177
-	SEN0177 sen0177;
-	HardwareSerial PM_SER(1);
-#endif
 
-#if USE_BME688
-	BME68X bme688;
-#endif
+// 교정 곡선 NVS 키 (g_cal_co/g_cal_mq2는 src/app/Jobs.h)
+static constexpr const char* CAL_KEY_CO  = "co";
+static constexpr const char* CAL_KEY_MQ2 = "mq2";
 
-#if USE_SGP30
-	SGP30X sgp30;
-#endif
 
-#if USE_SPS30
-	SPS30X sps30;
-#endif
 
-#if USE_SMOKE2
-	SMOKE2 smoke2;
-#endif
+// ---- Warm restart 스냅샷 (core/WarmState.h) ----
+// 드라이버 필터 상태를 주기적으로 RTC 메모리에, 재시작 직전(/save, /update)에는 NVS에도 저장하고
+// 부팅 시 복원하여 MQ2/SMOKE2/BME688 안정화 대기 없이 첫 주기부터 발행합니다.
+#define WARM_SCHEMA          1
+#define WARM_MAX_AGE_S       600     // 이보다 오래된 스냅샷은 버림 (센서가 식었을 수 있음)
+#define WARM_SNAPSHOT_MS     30000
 
-#if USE_ICS43434
-	ICS43434X mic;
-#endif
+struct WarmSnap {
+	uint32_t uptime_s;     // 저장 시점 가동 시간 (로그용)
+	#if USE_MQ2
+		MQ2::WarmState mq2;
+	#endif
+	#if USE_SMOKE2
+		SMOKE2::WarmState smoke2;
+	#endif
+	#if USE_BME688
+		BME68X::WarmState bme688;
+	#endif
+};
+static_assert(sizeof(WarmSnap) <= warm::CAP, "warm snapshot too large");
 
+static void warm_snapshot(bool to_nvs){
+	WarmSnap w;
+	memset(&w, 0, sizeof(w));
+	w.uptime_s = millis() / 1000;
+	#if USE_MQ2
+		mq2.saveState(w.mq2);
+	#endif
+	#if USE_SMOKE2
+		smoke2.saveState(w.smoke2);
+	#endif
+	#if USE_BME688
+		bme688.saveState(w.bme688);
+	#endif
+	uint32_t ts = epoch_now();
+	warm::saveRtc(&w, sizeof(w), WARM_SCHEMA, ts);
+	if(to_nvs) warm::saveNvs(&w, sizeof(w), WARM_SCHEMA, ts);
+}
 
-static void wifi_connect_blocking(){
-	if(WiFi.status() == WL_CONNECTED) return;
-	WiFi.mode(WIFI_STA);
-	WiFi.setAutoReconnect(true);
-	WiFi.persistent(false);
-	WiFi.begin(g_config.wifi_ssid, g_config.wifi_pass);
-	uint32_t t0 = millis();
-	while(WiFi.status() != WL_CONNECTED && (millis() - t0) < 15000){
-		Serial.print(".");
-		delay(200);
-	}
+// 부팅 시 1회 로드. 각 드라이버 begin() 직후 s_warm의 해당 부분을 restoreState()로 적용
+static WarmSnap s_warm;
+static bool s_warm_ok = false;
+
+static void warm_load(){
+	warm::Source src = warm::load(&s_warm, sizeof(s_warm), WARM_SCHEMA, epoch_now(), WARM_MAX_AGE_S);
+	s_warm_ok = (src != warm::NONE);
+	if(s_warm_ok) Serial.printf("[WARM] snapshot from %s (saved at uptime %lu s)\n", warm::sourceName(src), (unsigned long)s_warm.uptime_s);
 }
 
+
 static void mqtt_connect_nonblock(){
 	if(g_mqtt.connected()) return;
 	uint32_t now = millis();
-	if(now - g_lastConnMs < 2000) return; // simple backoff
-	g_lastConnMs = now;
+	if((int32_t)(now - g_mqttRetryAt) < 0) return; // 지수 백오프 + 지터
 	g_mqtt.setServer(g_config.mqtt_host, g_config.mqtt_port);
 
 	// LWT(유언) 메시지 설정: 연결이 비정상적으로 끊기면 브로커가 "offline" 메시지를 발행
@@ -184,216 +291,271 @@ static void mqtt_connect_nonblock(){
 	const char* willTopic = MQTT_STATUS_TOPIC;
 	const char* willPayload = "offline";
 
+	bool ok;
 	if(strlen(g_config.mqtt_user) > 0){
-		g_mqtt.connect("ait-node", g_config.mqtt_user, g_config.mqtt_pass, willTopic, willQos, willRetain, willPayload);
+		ok = g_mqtt.connect("ait-node", g_config.mqtt_user, g_config.mqtt_pass, willTopic, willQos, willRetain, willPayload);
 	}else{
-		g_mqtt.connect("ait-node", willTopic, willQos, willRetain, willPayload);
+		ok = g_mqtt.connect("ait-node", willTopic, willQos, willRetain, willPayload);
 	}
+	if(ok) g_mqttBackoff.reset();
+	else   g_mqttRetryAt = millis() + g_mqttBackoff.next();
 }
 
+// Wi-Fi/MQTT 연결 관리. 어떤 경우에도 대기하지 않습니다.
+// (브로커 TCP 접속만 소켓 타임아웃 범위에서 짧게 차단될 수 있음)
 static void net_loop(){
-	if(WiFi.status() != WL_CONNECTED){
-		wifi_connect_blocking();
-	}
+	g_wifi.loop();
+	if(!g_wifi.connected()) return;
 	if(!g_mqtt.connected()){
 		mqtt_connect_nonblock();
 	}
 	g_mqtt.loop();
 }
 
+// MQTT (재)연결 직후: 상태 "online"(retain)과 단절 통계 발행
+static void publish_link_up(){
+	uint32_t mqtt_outage = g_mqttDownSince ? millis() - g_mqttDownSince : 0;
+	g_mqtt.publish(MQTT_STATUS_TOPIC, "online", true);
+
+	const WifiLink::Stats &ws = g_wifi.stats();
+	char buf[200];
+	JsonBuf js(buf, sizeof(buf));
+	js.addU("wifi_disconnects", ws.disconnects);
+	js.addU("wifi_attempts", ws.attempts);
+	js.addU("wifi_last_outage_ms", ws.last_outage_ms);
+	js.addU("wifi_max_outage_ms", ws.max_outage_ms);
+	js.addU("wifi_reason", ws.last_reason);
+	js.addU("mqtt_reconnects", g_mqttReconnects);
+	js.addU("mqtt_outage_ms", mqtt_outage);
+	size_t n = js.finish();
+	if (n) g_mqtt.publish(MQTT_LINK_TOPIC, (const uint8_t*)buf, n, false);
+}
+
 // =================================================================
 // FreeRTOS Tasks
 // =================================================================
+// 센서 잡/발행 경로(g_sched, g_sample, g_msgPool)는 src/app/Jobs.cpp (호스트 벤치와 공용)
+
+#if ENABLE_METRICS
+// /metrics 응답을 청크로 흘려 보내는 Print (전체 텍스트를 메모리에 만들지 않음)
+class HttpChunkOut : public Print {
+	public:
+		size_t write(uint8_t c) override { return write(&c, 1); }
+		size_t write(const uint8_t *p, size_t n) override {
+			for (size_t i = 0; i < n; i++) {
+				_buf[_n++] = (char)p[i];
+				if (_n == sizeof(_buf)) send();
+			}
+			return n;
+		}
+		void send(){ if (_n) g_server.sendContent(_buf, _n); _n = 0; }
+	private:
+		char   _buf[512];
+		size_t _n = 0;
+};
+
+// 지표 대상 등록 + STA 모드 웹 서버에 /metrics 등록 (setup() 끝, 모든 Task 생성 후)
+static void metrics_init(){
+	metrics::addTask("loop", xTaskGetCurrentTaskHandle());
+	metrics::addTask("sensor", g_sensorTaskHandle);
+	metrics::addTask("mqtt", g_mqttTaskHandle);
+	#if USE_SMOKE2
+		metrics::addTask("smoke2", smoke2.task());
+	#endif
+	#if USE_ADS1115
+		metrics::addTask("ads1115", ads.task());
+	#endif
+	#if USE_ICS43434
+		metrics::addTask("mic", mic.task());
+	#endif
+	metrics::addGauge("pool_pending", [](){ return (uint32_t)g_msgPool.pending(); });
+	#if ENABLE_FLASH_SPOOL
+		metrics::addGauge("spool_bytes", [](){ return (uint32_t)g_spool.bytesPending(); });
+	#endif
+
+	g_server.on("/metrics", HTTP_GET, [](){
+		g_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+		g_server.send(200, "text/plain; version=0.0.4", "");
+		HttpChunkOut out;
+		metrics::writeText(out);
+		out.send();
+		g_server.sendContent("");   // 청크 전송 종료
+	});
+	g_server.begin();
+}
+#endif
+
+// 필터 상태를 RTC 메모리에 주기 저장 (워치독/패닉 리셋 후에도 이어 쓰기)
+static uint32_t job_warm(void*, uint32_t){
+	if (g_systemReady) warm_snapshot(false);
+	return 0;
+}
 
 /**
- * @brief 1초마다 센서 값을 읽어 JSON으로 만들고 Queue에 전송하는 Task
+ * @brief 센서별 주기로 잡을 등록하고, 마감시각 순서로 실행하는 Task
  * @param pvParameters Task 파라미터 (사용 안 함)
  */
 void sensorTask(void *pvParameters) {
-	bool g_systemReady = false; // 모든 센서가 안정화되었는지 확인하는 플래그
-
 	Serial.println("Sensor Task: started");
-	bool led3 = false;
 
-	// vTaskDelayUntil을 위한 변수 초기화
-	TickType_t xLastWakeTime;
-	const TickType_t xFrequency = pdMS_TO_TICKS(1000); // 1000ms 주기
-	xLastWakeTime = xTaskGetTickCount(); // 현재 시간을 기준으로 시작
+	// 잡 등록 (같은 마감시각이면 등록 순서대로 실행 → 발행 잡은 마지막에 등록)
+	jobs::addSensors();
+	g_sched.add("warm", WARM_SNAPSHOT_MS, job_warm, nullptr, WARM_SNAPSHOT_MS);
+	jobs::addPublish();
 
 	for (;;) {
-		// 정확한 1초 주기를 위해 다음 실행 시간까지 대기
-		vTaskDelayUntil(&xLastWakeTime, xFrequency);
-
-		// 시스템이 아직 준비되지 않았다면, 센서들의 준비 상태를 확인
-		if (!g_systemReady) {
-			bool mq2_ready = false;
-			bool bme688_ready = false;
-			bool smoke2_ready = false;
-
-			#if USE_MQ2
-				mq2_ready = (mq2.phase() == MQ2::RUN);
-			#else
-				mq2_ready = true;
-			#endif
-
-			#if USE_BME688
-				// bme.isReading() 과 같은 명시적인 준비 함수가 없으므로,
-				// 첫 번째 유효한 가스 저항 값(0 이상)을 받으면 준비된 것으로 간주합니다.
-				bme688_ready = (bme688.last_gas_resistance() > 0);
-			#else
-				bme688_ready = true;
-			#endif
-
-			#if USE_SMOKE2
-				smoke2_ready = smoke2.isBaselineReady();
-			#else
-				smoke2_ready = true;
-			#endif
-
-			if (mq2_ready && bme688_ready && smoke2_ready) {
-				g_systemReady = true;
-				Serial.println("[SYSTEM] All sensors are ready. Starting MQTT publish.");
-			} else {
-				// 디버깅: 어떤 센서가 아직 준비되지 않았는지 확인
-				Serial.printf("[SYSTEM] Waiting for sensors... MQ2: %d, BME688: %d, SMOKE2: %d\n",
-					(int)mq2_ready, (int)bme688_ready, (int)smoke2_ready
-				);
-			}
-		}
-
-		//led3 = !led3;
-		leds::blink3(1);
-
-		StreamString json_buf;
-		// JSON 부분은 반드시 { ... }로 사용해야 함
-		{
-			JsonOut js(json_buf);
-
-			#if USE_SPS30
-			static uint16_t pm1, pm25, pm4, pm10;
-			if(sps30.read(pm1,pm25,pm4,pm10)){ js.add("pm1_0",pm1); js.add("pm2_5",pm25); js.add("pm4_0",pm4); js.add("pm10",pm10); }
-			#endif
-
-			#if USE_BME688
-			float t,h,g; 
-			if(bme688.read(t,h,g)){ js.add("temp",t); js.add("hum",h); float g_kohm = roundf((g * 0.001f) * 1000.0f) / 1000.0f; js.add("gas_kohm",g_kohm,3); }
-			#endif
-
-			#if USE_SMOKE2
-			SMOKE2::Reading sr;
-			if (smoke2.read(sr)) { js.addU("smk_blue", (uint32_t)sr.blue); js.addU("smk_ir", (uint32_t)sr.ir); js.add("smk_ratio", sr.ratio, 3); js.add("smk_alpha", sr.alpha, 3); js.add("smk_score", sr.score, 0); js.addU("smk_alarm", sr.alarm ? 1u : 0u); }
-			#endif
-
-			#if USE_SGP30
-			uint16_t eco2,tvoc; 
-			if(sgp30.read(eco2,tvoc)){ js.addU("eCO2_ppm",eco2); js.addU("TVOC_ppb",tvoc); }
-			#endif
-
-			#if USE_CO_ADC   // GSET11-P110 테이블 기준
-
-			// 노이즈에 더 강한 'Trimmed Mean' 방식 적용
-			// 10회 측정 후 최소/최대 2개씩 제외하고 6개 값으로 평균 계산
-			const int SAMPLE_COUNT = 10;
-			float samples[SAMPLE_COUNT];
-
-			for (int i = 0; i < SAMPLE_COUNT; i++) {
-				samples[i] = ads.read_V(0);
-				delay(10); // 10ms 대기
-			}
-
-			// 측정된 샘플을 오름차순으로 정렬 (간단한 삽입 정렬 사용)
-			for (int i = 1; i < SAMPLE_COUNT; i++) {
-				float key = samples[i];
-				int j = i - 1;
-				while (j >= 0 && samples[j] > key) {
-					samples[j + 1] = samples[j];
-					j = j - 1;
-				}
-				samples[j + 1] = key;
-			}
-
-			// 최소값 2개, 최대값 2개를 제외한 나머지 6개의 합계를 계산
-			float co_V_sum = 0.0f;
-			for (int i = 2; i < SAMPLE_COUNT - 2; i++) {
-				co_V_sum += samples[i];
-			}
-			float co_V = co_V_sum / (SAMPLE_COUNT - 4); // 6개 값의 평균
-			float CO_ppm;
-
-			// 1) 너무 낮은 전압은 0ppm으로 처리 (노이즈/오류 방지용)
-			if (co_V <= 1.0f) {
-				CO_ppm = 0.0f;
-
-			// 2) 구간1 : 1.0 ~ 1.82 V (대략 0~100 ppm)
-			} else if (co_V < 1.82f) {
-				CO_ppm = 151.864662f * co_V * co_V
-					- 303.866154f * co_V
-					+ 153.910337f;
-
-			// 3) 구간2 : 1.82 ~ 2.18 V (대략 110~220 ppm)
-			} else if (co_V < 2.18f) {
-				CO_ppm = 127.987999f * co_V * co_V
-					- 177.634899f * co_V
-					+ 2.772567f;
-
-			// 4) 구간3 : 2.18 ~ 2.61 V (대략 230~400 ppm)
-			} else if (co_V < 2.61f) {
-				CO_ppm = 134.327926f * co_V * co_V
-					- 177.884252f * co_V
-					- 26.303081f;
-
-			// 5) 구간4 : 2.61 ~ 3.55 V (대략 450~1000 ppm)
-			} else {
-				CO_ppm = 79.481009f * co_V * co_V
-					+ 123.214449f * co_V
-					- 439.821071f;
-			}
-
-			// 6) 안전하게 범위 클램프
-			if (CO_ppm < 0.0f)    CO_ppm = 0.0f;
-			if (CO_ppm > 1000.0f) CO_ppm = 1000.0f;
-
-			js.add("CO_V", co_V);	
-			js.add("CO_ppm", CO_ppm);
+		// 가장 이른 마감시각까지 대기 후 마감된 잡 실행
+		jobs::wait();
+		jobs::dispatch();
+	}
+}
 
-		#endif
+#if ENABLE_FLASH_SPOOL
+// 페이로드에 들어 있는 ts (없으면 0)
+static uint32_t payload_ts(uint8_t tag, const char* data, uint16_t len){
+	if (tag == MSG_TELEMETRY_BIN) {
+		uint32_t ts = 0;
+		if (len >= telem::TELEM_BIN_HEADER) memcpy(&ts, data + 8, sizeof(ts));
+		return ts;
+	}
+	static const char key[] = "{ \"ts\":";
+	if (len > sizeof(key) - 1 && strncmp(data, key, sizeof(key) - 1) == 0) return strtoul(data + sizeof(key) - 1, nullptr, 10);
+	return 0;
+}
 
-			#if USE_ADS1115 && USE_MQ2
-			float mq_mV = ads.read_mV(1); mq2.update_from_adc_mV(mq_mV); js.add("mq2_mV", mq_mV); js.add("mq2_Rs", mq2.rs(),0); js.add("mq2_ratio", mq2.ratio()); js.add("mq2_ema", mq2.ratio_ema()); if(mq2.alarm()) leds::set3(true); else leds::set3(false);
-			#endif
+// 발행하지 못한 레코드를 플래시에 보관
+static void spool_rec(uint8_t tag, const char* data, uint16_t len){
+	if (!g_spool.ready()) return;
+	FlashSpool::RecHdr h;
+	h.len = len;
+	h.tag = tag;
+	h.ts = payload_ts(tag, data, len);
+	h.flags = h.ts ? SPOOL_F_HAS_TS : 0;
+	if (!h.ts) h.ts = epoch_now();
+	h.uptime_s = millis() / 1000;
+	h.boot_id = g_bootId;
+	if (!g_spool.append(h, data)) Serial.println("MQTT Task: spool write failed");
+}
 
-			#if USE_ADS1115
-			js.add("Smoke_mV", ads.read_mV(2));
-			#endif
+// 재전송 시 페이로드에 넣을 ts. 기록 당시 시계가 없었어도 같은 부팅 세션이면 uptime으로 환산합니다.
+static uint32_t replay_ts(const FlashSpool::RecHdr &h){
+	if (h.flags & SPOOL_F_HAS_TS) return 0;   // 이미 들어 있음
+	if (h.ts) return h.ts;
+	uint32_t now = epoch_now();
+	if (!now || h.boot_id != g_bootId) return 0;
+	return now - (millis() / 1000 - h.uptime_s);
+}
 
-			#if USE_ICS43434
-			js.add("mic_rms", mic.read_rms(),0);
-			#endif
+// 보관된 레코드를 한 묶음(같은 tag) 재전송. 발행 성공 시에만 커서를 진행합니다.
+static void replay_batch(){
+	static_assert(TELEMETRY_SLOT_SIZE + 32 <= REPLAY_MAX_BYTES, "replay buffer must hold one slot");
+	static FlashSpool::RecHdr hdrs[REPLAY_BATCH];
+	static uint8_t buf[REPLAY_MAX_BYTES];
+
+	uint8_t n = g_spool.peek(hdrs, REPLAY_BATCH);
+	if (!n) return;
+	const uint8_t tag = hdrs[0].tag;
+	const bool json = (tag != MSG_TELEMETRY_BIN);
+
+	size_t len = 0;
+	uint8_t k = 0;
+	if (json) buf[len++] = '[';
+	for (; k < n; k++) {
+		const FlashSpool::RecHdr &h = hdrs[k];
+		uint32_t ts = replay_ts(h);
+		char pre[24] = "";
+		size_t pre_len = 0;
+		if (json && ts) pre_len = snprintf(pre, sizeof(pre), "{ \"ts\":%lu,", (unsigned long)ts);
+
+		// JSON: "{ " → "{ "ts":N, " 로 치환, 구분자 ',' 와 닫는 ']' 자리 확보
+		size_t need = h.len + (json ? (pre_len ? pre_len - 1 : 0) + 2 : 0);
+		if (len + need > sizeof(buf)) break;
+
+		const size_t sep = (json && k > 0) ? 1 : 0;
+		uint8_t *dst = buf + len + sep + (pre_len ? pre_len - 1 : 0);
+		if (!g_spool.readPayload(k, dst, sizeof(buf) - (dst - buf))) break;
+		if (sep) buf[len] = ',';
+		if (pre_len) memcpy(buf + len + sep, pre, pre_len);   // 원래의 '{'를 덮어씀
+		else if (!json && ts) memcpy(dst + 8, &ts, sizeof(ts));
+		len += sep + h.len + (pre_len ? pre_len - 1 : 0);
+	}
+	if (k == 0) {
+		// 슬롯 크기 < REPLAY_MAX_BYTES 이므로 첫 레코드는 항상 들어감 → 읽기 실패한 레코드는 건너뜀
+		Serial.println("MQTT Task: unreadable spool record skipped");
+		g_spool.consume(1);
+		return;
+	}
+	if (json) buf[len++] = ']';
 
-			#if USE_SEN0177
-			PM25Data d; if(sen0177.read(d)){ js.addU("pm1_0", d.pm1_0); js.addU("pm2_5", d.pm2_5); js.addU("pm10", d.pm10); }
-			#endif
+	const char* topic = replay_topic_for_tag(tag);
+	if (g_mqtt.beginPublish(topic, len, false) && g_mqtt.write(buf, len) == len && g_mqtt.endPublish()) {
+		g_spool.consume(k);
+	}
+}
+#endif
 
-			#if USE_ZE07
-			if(ze07.read_frame(300)){ float ppm=0; uint16_t full=0; uint8_t dec=0; if(ze07.parse_ppm(ppm, full, dec)){ js.add("ZE07_CO_ppm", ppm, 1); } }
-			#endif
+// ---- MQTT 묶음 발행 ----
+struct PubBatch {
+	uint8_t  count = 0;
+	uint32_t first_ms = 0;
+	uint16_t len = 0;
+	uint16_t off[BATCH_K_MAX];   // 레코드별 위치/길이 (발행 실패 시 개별 보관용)
+	uint16_t rlen[BATCH_K_MAX];
+	char     buf[BATCH_MAX_BYTES];
+};
+static PubBatch g_batch[MSG_BATCH_TAGS];
+
+// 묶음 발행. 실패하면 레코드별로 플래시에 보관합니다.
+static void batch_flush(uint8_t tag){
+	PubBatch &b = g_batch[tag];
+	if (b.count == 0) return;
+
+	bool sent = false;
+	if (g_mqtt.connected()) {
+		const char* topic = topic_for_tag(tag);
+		if (b.count == 1) {
+			sent = g_mqtt.publish(topic, (const uint8_t*)b.buf, b.len, false);
+		} else if (tag == MSG_TELEMETRY_BIN) {
+			sent = g_mqtt.beginPublish(topic, b.len, false)
+				&& g_mqtt.write((const uint8_t*)b.buf, b.len) == b.len && g_mqtt.endPublish();
+		} else {
+			sent = g_mqtt.beginPublish(topic, b.len + 2, false) && g_mqtt.write('[')
+				&& g_mqtt.write((const uint8_t*)b.buf, b.len) == b.len && g_mqtt.write(']') && g_mqtt.endPublish();
 		}
+	}
+	#if ENABLE_FLASH_SPOOL
+	if (!sent) {
+		for (uint8_t i = 0; i < b.count; i++) spool_rec(tag, b.buf + b.off[i], b.rlen[i]);
+	}
+	#else
+	(void)sent;
+	#endif
+	b.count = 0;
+	b.len = 0;
+}
 
-		// 생성된 JSON 문자열을 Queue로 전송
-		if (g_systemReady) {
-			if (json_buf.length() > 0) {
-				char msg_payload[MAX_JSON_MSG_SIZE]; // 스택에 버퍼 할당
-				// strncpy로 안전하게 복사 (메모리 누수 위험 없음)
-				strncpy(msg_payload, json_buf.c_str(), MAX_JSON_MSG_SIZE - 1);
-				msg_payload[MAX_JSON_MSG_SIZE - 1] = '\0'; // 항상 NULL로 종료 보장
-
-				// 10ms 타임아웃으로 Queue에 전송 시도
-				// xQueueSend는 메시지를 '복사'하므로, 함수가 반환된 후 msg_payload는 안전하게 파괴됨
-				if (xQueueSend(g_mqttQueue, msg_payload, pdMS_TO_TICKS(10)) != pdPASS) {
-					Serial.println("Sensor Task: Failed to send to queue, queue full?");
-				}
-			}
-		}
+// 메시지를 묶음에 복사. 조건(개수/경보)을 만족하면 바로 발행합니다.
+static void batch_add(const TelemetryPool::Msg *msg){
+	PubBatch &b = g_batch[msg->tag];
+	const bool json = (msg->tag != MSG_TELEMETRY_BIN);
+	if (b.count > 0 && b.len + 1 + msg->len + 2 > sizeof(b.buf)) batch_flush(msg->tag);
+
+	if (b.count == 0) b.first_ms = millis();
+	else if (json) b.buf[b.len++] = ',';
+	b.off[b.count] = b.len;
+	b.rlen[b.count] = msg->len;
+	memcpy(b.buf + b.len, msg->data, msg->len);
+	b.len += msg->len;
+	b.count++;
+
+	if (b.count >= g_config.batch_k || b.count >= BATCH_K_MAX || (msg->flags & MSG_F_ALARM)) batch_flush(msg->tag);
+}
+
+// batch_ms가 지난 묶음 발행
+static void batch_poll(){
+	uint32_t now = millis();
+	for (uint8_t t = 0; t < MSG_BATCH_TAGS; t++) {
+		if (g_batch[t].count && now - g_batch[t].first_ms >= g_config.batch_ms) batch_flush(t);
 	}
 }
 
@@ -403,8 +565,13 @@ void sensorTask(void *pvParameters) {
  */
 void mqttTask(void *pvParameters) {
 	Serial.println("MQTT Task: started");
-	char received_payload[MAX_JSON_MSG_SIZE];
-	bool birth_message_published = false; // Birth 메시지가 발행되었는지 추적하는 플래그
+	bool mqtt_was_connected = false; // (재)연결 시점마다 Birth 메시지를 다시 발행하기 위한 상태
+	#if ENABLE_FLASH_SPOOL
+	uint32_t last_replay_ms = 0;
+	if (g_spool.ready() && !g_spool.empty()) {
+		Serial.printf("MQTT Task: %lu bytes spooled from previous outage\n", (unsigned long)g_spool.bytesPending());
+	}
+	#endif
 
 	for (;;) {
 		// WiFi 및 MQTT 연결 관리
@@ -412,21 +579,49 @@ void mqttTask(void *pvParameters) {
 		net_loop();
 		
 		// Queue에서 메시지를 기다림 (최대 100ms 대기)
-		if (xQueueReceive(g_mqttQueue, received_payload, pdMS_TO_TICKS(100)) == pdPASS) {
+		TelemetryPool::Msg *msg = g_msgPool.receive(pdMS_TO_TICKS(100));
+		if (msg) {
+			bool sent = false;
 			if (g_mqtt.connected()) {
-				g_mqtt.publish(MQTT_TOPIC, (const uint8_t*)received_payload, strlen(received_payload), false);
+				if (g_config.batch_k > 1 && msg->tag < MSG_BATCH_TAGS) {
+					batch_add(msg); // 묶음에 복사 (발행 실패분은 batch_flush에서 보관)
+					sent = true;
+				} else {
+					sent = g_mqtt.publish(topic_for_tag(msg->tag), (const uint8_t*)msg->data, msg->len, false);
+				}
 				#if USE_DEBUG
-				Serial.print("[MQTT Task] Published: "); Serial.println(received_payload);
+				if (msg->tag == MSG_TELEMETRY) { Serial.print("[MQTT Task] Published: "); Serial.println(msg->data); }
 				#endif
 			}
+			#if ENABLE_FLASH_SPOOL
+			if (!sent && msg->tag != MSG_METRICS) spool_rec(msg->tag, msg->data, msg->len); // 단절/발행 실패 → 플래시에 보관
+			#else
+			(void)sent;
+			#endif
+			g_msgPool.release(msg); // publish 완료 후 슬롯 반환
 		}
+		batch_poll();
+
+		#if ENABLE_FLASH_SPOOL
+		// 실시간 메시지가 밀려 있지 않을 때만, 정해진 간격으로 한 묶음씩 재전송
+		if (g_mqtt.connected() && g_msgPool.pending() == 0 && !g_spool.empty()
+			&& millis() - last_replay_ms >= REPLAY_INTERVAL_MS) {
+			last_replay_ms = millis();
+			replay_batch();
+		}
+		#endif
 
-		// MQTT가 연결되었고, 아직 Birth 메시지를 발행하지 않았다면 발행합니다.
-		if (g_mqtt.connected() && !birth_message_published) {
+		// MQTT가 (재)연결되면 Birth 메시지를 발행합니다. (LWT "offline"이 retain으로 남아 있으므로 매번 갱신)
+		bool mqtt_up = g_mqtt.connected();
+		if (mqtt_up && !mqtt_was_connected) {
 			Serial.println("MQTT Task: Publishing birth message.");
-			g_mqtt.publish(MQTT_STATUS_TOPIC, "online", true);
-			birth_message_published = true; // 발행되었음을 표시하여 다시 발행하지 않도록 함
+			publish_link_up();
+			g_mqttDownSince = 0;
+		} else if (!mqtt_up && mqtt_was_connected) {
+			g_mqttDownSince = millis();
+			g_mqttReconnects++;
 		}
+		mqtt_was_connected = mqtt_up;
 	}
 }
 
@@ -452,6 +647,8 @@ void loadConfiguration() {
 		strcpy(g_config.mqtt_user, "");
 		strcpy(g_config.mqtt_pass, "");
 		g_config.mq2_r0 = DEFAULT_MQ2_R0;
+		g_config.batch_k = DEFAULT_BATCH_K;
+		g_config.batch_ms = DEFAULT_BATCH_MS;
 
 		// 이 기본값들을 NVS에 즉시 저장
 		saveConfiguration();
@@ -465,6 +662,8 @@ void loadConfiguration() {
 		g_prefs.getString("mqtt_pass", g_config.mqtt_pass, sizeof(g_config.mqtt_pass));
 		g_config.mq2_r0 = g_prefs.getFloat("mq2_r0", DEFAULT_MQ2_R0);
 		g_config.smoke2_alpha = g_prefs.getFloat("smoke2_alpha", 0.0f); // 0.0f는 아직 교정되지 않았음을 의미
+		g_config.batch_k = g_prefs.getUChar("batch_k", DEFAULT_BATCH_K);
+		g_config.batch_ms = g_prefs.getUShort("batch_ms", DEFAULT_BATCH_MS);
 	}
 	g_prefs.end();
 }
@@ -480,9 +679,46 @@ void saveConfiguration() {
 	g_prefs.putString("mqtt_pass", g_config.mqtt_pass);
 	g_prefs.putFloat("mq2_r0", g_config.mq2_r0);
 	g_prefs.putFloat("smoke2_alpha", g_config.smoke2_alpha);
+	g_prefs.putUChar("batch_k", g_config.batch_k);
+	g_prefs.putUShort("batch_ms", g_config.batch_ms);
 	g_prefs.end();
 }
 
+// 장치별 교정 곡선 로드 (없거나 손상되었으면 기본 테이블 유지)
+static void cal_load(){
+	if(g_cal_co.load(CAL_KEY_CO))   Serial.println("[CAL] CO curve loaded from NVS");
+	if(g_cal_mq2.load(CAL_KEY_MQ2)) Serial.println("[CAL] MQ2 curve loaded from NVS");
+}
+
+// 포털 입력 저장: 빈 값은 변경 없음, "default"는 NVS 테이블 삭제(기본 테이블로 복귀), 그 외는 텍스트 형식 파싱
+// sensorTask가 잠금 없이 eval()하는 g_cal_*는 건드리지 않고 NVS에만 쓰며, 저장 후 재부팅 시 cal_load()가 적용합니다.
+static bool cal_store(const char* key, const String &arg){
+	if(arg.length() == 0) return true;
+	if(arg.equalsIgnoreCase("default")){
+		cal::Curve::erase(key);
+		return true;
+	}
+	cal::Table t;
+	if(!cal::Curve::parse(arg.c_str(), t)){
+		Serial.printf("[CAL] invalid %s curve: %s\n", key, arg.c_str());
+		return false;
+	}
+	return cal::Curve::save(key, t);
+}
+
+// 플래시의 gzip 자원을 그대로 전송 (힙에 페이지를 만들지 않음, send_P가 플래시에서 조각씩 읽어 보냄)
+// 브라우저는 매번 ETag로 재검증하고, 바뀌지 않았으면 본문 없이 304만 받습니다.
+static void serve_asset(const web::Asset &a){
+	g_server.sendHeader("ETag", a.etag);
+	g_server.sendHeader("Cache-Control", "no-cache");
+	if (g_server.header("If-None-Match") == a.etag) {
+		g_server.send(304);
+		return;
+	}
+	g_server.sendHeader("Content-Encoding", "gzip");
+	g_server.send_P(200, a.type, (PGM_P)a.gz, a.len);
+}
+
 void startConfigPortal() {
 	const char* ap_ssid = "SensorHub-Config";
 	Serial.println("\nStarting Configuration Portal.");
@@ -500,149 +736,8 @@ void startConfigPortal() {
 	leds::blink4(1);
 
 	// 루트 페이지 및 Captive Portal을 위한 "Catch-all" 핸들러
-	auto handleRoot = []() {
-		String html = R"rawliteral(
-			<!DOCTYPE html><html><head><title>SensorHub Config</title>
-            <meta name="viewport" content="width=device-width, initial-scale=1">
-            <style>
-                body { font-family: -apple-system, BlinkMacSystemFont, "Segoe UI", Roboto, Helvetica, Arial, sans-serif; background-color: #f4f6f8; color: #333; margin: 0; padding: 20px; display: flex; justify-content: center; align-items: center; min-height: 100vh; }
-                .container { background-color: #fff; padding: 30px; border-radius: 8px; box-shadow: 0 4px 12px rgba(0,0,0,0.1); max-width: 400px; width: 100%; }
-                h1, h2 { color: #1a2533; text-align: center; border-bottom: 1px solid #eee; padding-bottom: 10px; margin-bottom: 20px; }
-                h1 { font-size: 1.8em; }
-                h2 { font-size: 1.2em; margin-top: 30px; }
-                p { text-align: center; margin-top: -10px; margin-bottom: 30px; color: #888; }
-                label { display: block; margin-top: 15px; font-weight: bold; font-size: 0.9em; }
-                input { width: 100%; padding: 12px; margin-top: 5px; border: 1px solid #ccc; border-radius: 4px; box-sizing: border-box; }
-                .btn-container { display: flex; gap: 10px; margin-top: 30px; }
-                button { background-color: #007aff; color: white; padding: 14px 20px; border: none; border-radius: 4px; cursor: pointer; width: 100%; font-size: 1em; font-weight: bold; }
-                button:hover { background-color: #0056b3; }
-                button.secondary { background-color: #6c757d; }
-                button.secondary:hover { background-color: #5a6268; }
-                a { color: #007aff; text-decoration: none; display: block; text-align: center; margin-top: 20px; }
-            </style>
-            </head><body>
-            <div class="container">
-			    <form action="/save" method="POST">
-				<h1>SensorHub Configuration</h1>
-				
-                <h2>WiFi Settings</h2>
-				<label for="ssid">SSID</label>
-				<input type="text" id="ssid" name="ssid" value=")rawliteral";
-		html += g_config.wifi_ssid;
-		html += R"rawliteral(">
-				<label for="pass">Password</label>
-				<input type="password" id="pass" name="pass">
-
-				<h2>MQTT Settings</h2>
-				<label for="host">Broker Host</label>
-				<input type="text" id="host" name="host" value=")rawliteral";
-		html += g_config.mqtt_host;
-		html += R"rawliteral(">
-				<label for="port">Port</label>
-				<input type="number" id="port" name="port" value=")rawliteral";
-		html += String(g_config.mqtt_port);
-		html += R"rawliteral(">
-				<label for="user">User (optional)</label>
-				<input type="text" id="user" name="user" value=")rawliteral";
-		html += g_config.mqtt_user;
-		html += R"rawliteral(">
-				<label for="m_pass">Password (optional)</label>
-				<input type="password" id="m_pass" name="m_pass">
-
-				<h2>Sensor Calibration</h2>
-				<p>Place the device in clean air before calibrating.</p>
-				<button type="button" id="calibBtn" class="secondary">Calibrate MQ-2 R0</button>
-				<p id="calib_status"></p>
-				<br>
-				<button type="button" id="calibSmokeBtn" class="secondary">Calibrate SMOKE 2 Alpha</button>
-				<p id="calib_status"></p>
-
-                <div class="btn-container">
-				    <button type="submit">Save & Reboot</button>
-                </div>
-
-				<h2>Live Sensor Status</h2>
-				<p id="status_area">Loading...</p>
-				    <button type="button" id="readBtn" class="secondary">Read Saved</button>
-
-                <a href="/update">Go to Firmware Update</a>
-			</form>
-            </div></body></html>
-            <script>
-                document.getElementById('calibBtn').addEventListener('click', function() {
-                    const statusEl = document.getElementById('calib_status');
-                    statusEl.innerText = 'Calibrating... Please wait about 30 seconds.';
-                    this.disabled = true;
-
-                    fetch('/calibrate_mq2')
-                        .then(response => response.text())
-                        .then(data => {
-                            statusEl.innerText = data;
-                            this.disabled = false;
-                        })
-                        .catch(error => {
-                            console.error('Error:', error);
-                            statusEl.innerText = 'Calibration failed. Please try again.';
-                            this.disabled = false;
-                        });
-                });
-
-                document.getElementById('calibSmokeBtn').addEventListener('click', function() {
-                    const statusEl = document.getElementById('calib_status');
-                    statusEl.innerText = 'Calibrating SMOKE 2... Please wait about 20 seconds.';
-                    this.disabled = true;
-
-                    fetch('/calibrate_smoke2')
-                        .then(response => response.text())
-                        .then(data => {
-                            statusEl.innerText = data;
-                            this.disabled = false;
-                        })
-                        .catch(error => {
-                            statusEl.innerText = 'SMOKE 2 calibration failed.';
-                            this.disabled = false;
-                        });
-                });
-
-                document.getElementById('readBtn').addEventListener('click', function() {
-                    fetch('/readconfig')
-                        .then(response => response.json())
-                        .then(data => {
-                            document.getElementById('ssid').value = data.ssid;
-                            document.getElementById('host').value = data.host;
-                            document.getElementById('port').value = data.port;
-                            document.getElementById('user').value = data.user;
-                            // 보안을 위해 저장된 비밀번호는 다시 불러오지 않고, 입력 필드를 비웁니다.
-                            document.getElementById('pass').value = '';
-                            document.getElementById('m_pass').value = '';
-                            alert('Saved values have been loaded. Passwords are not shown for security.');
-                        })
-                        .catch(error => console.error('Error:', error));
-                });
-
-                function fetchStatus() {
-                    fetch('/status')
-                        .then(response => response.json())
-                        .then(data => {
-                            const statusEl = document.getElementById('status_area');
-                            let statusText = `MQ-2 R0 (Saved): ${data.mq2_r0.toFixed(0)} &Omega;<br>`;
-                            statusText += `MQ-2 Rs (Live): ${data.mq2_rs.toFixed(0)} &Omega;<br>`;
-                            statusText += `Rs/R0 Ratio: ${data.mq2_ratio.toFixed(3)}`;
-                            statusText += `<hr>SMOKE2 Alpha (Saved): ${data.smoke2_alpha.toFixed(4)}<br>`;
-                            statusText += `SMOKE2 Ratio (Live): ${data.smoke2_ratio.toFixed(4)}<br>`;
-                            statusText += `Score: ${data.smoke2_score.toFixed(0)}`;
-                            statusEl.innerHTML = statusText;
-                        })
-                        .catch(error => {
-                            document.getElementById('status_area').innerText = 'Failed to load status.';
-                        });
-                }
-                setInterval(fetchStatus, 5000); // 5초마다 상태 업데이트
-                fetchStatus(); // 페이지 로드 시 즉시 실행
-            </script>
-		)rawliteral";
-		g_server.send(200, "text/html", html);
-	};
+	// 페이지는 고정 gzip 자원이고, 설정 값은 페이지가 /readconfig로 받아 채웁니다.
+	auto handleRoot = []() { serve_asset(web::INDEX_HTML); };
 
 	// 웹 서버 저장 페이지 핸들러
 	auto handleSave = []() {
@@ -652,12 +747,19 @@ void startConfigPortal() {
 		g_config.mqtt_port = g_server.arg("port").toInt();
 		strncpy(g_config.mqtt_user, g_server.arg("user").c_str(), sizeof(g_config.mqtt_user));
 		strncpy(g_config.mqtt_pass, g_server.arg("m_pass").c_str(), sizeof(g_config.mqtt_pass));
+		g_config.batch_k = (uint8_t)constrain(g_server.arg("batch_k").toInt(), 1, BATCH_K_MAX);
+		g_config.batch_ms = (uint16_t)constrain(g_server.arg("batch_ms").toInt(), 100, 60000);
 
 		saveConfiguration();
+		bool cal_ok = cal_store(CAL_KEY_CO, g_server.arg("cal_co"));
+		cal_ok &= cal_store(CAL_KEY_MQ2, g_server.arg("cal_mq2"));
 
-		String html = "<html><body><h1>Settings Saved.</h1><h2>Rebooting...</h2></body></html>";
+		String html = "<html><body><h1>Settings Saved.</h1>";
+		if (!cal_ok) html += "<p>Invalid calibration curve ignored (previous curve kept).</p>";
+		html += "<h2>Rebooting...</h2></body></html>";
 		g_server.send(200, "text/html", html);
 
+		warm_snapshot(true);
 		delay(1000);
 		ESP.restart();
 	};
@@ -696,19 +798,19 @@ void startConfigPortal() {
 	auto handleCalibrateSmoke2 = []() {
 		g_server.send(200, "text/plain", "Calibrating SMOKE 2... This will take about 20 seconds.");
 
-		// 드라이버의 예열/교정 로직을 강제로 다시 실행
-		smoke2.begin(Wire, 0x64, 0.0f); // 0.0f를 전달하여 재교정 모드로 시작
-
-		// 20초간 대기하며 read()를 호출하여 베이스라인을 생성
-		for (int i = 0; i < 20; i++) {
-			SMOKE2::Reading r;
-			smoke2.read(r);
+		// 예열/기준선 초기화는 FIFO를 비우는 SMOKE2 Task(없으면 sensorTask)가 수행 → 여기서는 요청 후 완료만 대기
+		smoke2.requestRecalibrate();
+		for (int i = 0; i < 30 && smoke2.recalibrating(); i++) {
 			Serial.print("Timer : ");
 			Serial.println(i);
 			// Watchdog Timer가 리셋되지 않아 재부팅되는 것을 방지
 			esp_task_wdt_reset();
 			delay(1000);
 		}
+		if (smoke2.recalibrating()) {
+			Serial.println("SMOKE2 calibration timed out (sensor not sampling). Previous alpha kept.");
+			return;
+		}
 
 		g_config.smoke2_alpha = smoke2.getAlpha();
 		saveConfiguration();
@@ -719,67 +821,30 @@ void startConfigPortal() {
 	};
 
 	// 펌웨어 업데이트 페이지 핸들러
-	g_server.on("/update", HTTP_GET, []() {
-		String html = R"rawliteral(
-			<!DOCTYPE html><html><head><title>Firmware Update</title>
-			<meta name="viewport" content="width=device-width, initial-scale=1">
-			<style>
-				body { font-family: -apple-system, BlinkMacSystemFont, "Segoe UI", Roboto, Helvetica, Arial, sans-serif; background-color: #f4f6f8; color: #333; margin: 0; padding: 20px; display: flex; justify-content: center; align-items: center; min-height: 100vh; }
-				.container { background-color: #fff; padding: 30px; border-radius: 8px; box-shadow: 0 4px 12px rgba(0,0,0,0.1); max-width: 400px; width: 100%; text-align: center; }
-				h1 { color: #1a2533; }
-				input[type=file] { margin: 20px 0; }
-				button { background-color: #ff9500; color: white; padding: 14px 20px; border: none; border-radius: 4px; cursor: pointer; width: 100%; font-size: 1em; font-weight: bold; }
-				button:hover { background-color: #d67e00; }
-                .progress { width: 100%; background-color: #ddd; border-radius: 4px; margin-top: 20px; }
-                .bar { width: 0%; height: 20px; background-color: #007aff; border-radius: 4px; text-align: center; color: white; line-height: 20px; }
-			</style></head><body>
-			<div class="container">
-				<h1>Firmware Update</h1>
-				<form method="POST" action="/update" enctype="multipart/form-data">
-					<input type="file" name="update">
-					<button type="submit">Update</button>
-				</form>
-                <div class="progress"><div class="bar" id="progressBar">0%</div></div>
-			</div>
-            <script>
-                document.querySelector('form').addEventListener('submit', function(e) {
-                    e.preventDefault();
-                    var formData = new FormData(this);
-                    var xhr = new XMLHttpRequest();
-                    xhr.open('POST', '/update', true);
-                    xhr.upload.addEventListener('progress', function(e) {
-                        if (e.lengthComputable) {
-                            var percentComplete = (e.loaded / e.total) * 100;
-                            var bar = document.getElementById('progressBar');
-                            bar.style.width = percentComplete.toFixed(2) + '%';
-                            bar.textContent = percentComplete.toFixed(2) + '%';
-                        }
-                    });
-                    xhr.onload = function() {
-                        if (xhr.status === 200) {
-                            alert('Update Success! Rebooting...');
-                            setTimeout(function(){ window.location.href = '/'; }, 1000);
-                        } else {
-                            alert('Update Failed: ' + xhr.responseText);
-                        }
-                    };
-                    xhr.send(formData);
-                });
-            </script></body></html>)rawliteral";
-		g_server.send(200, "text/html", html);
-	});
+	g_server.on("/update", HTTP_GET, []() { serve_asset(web::UPDATE_HTML); });
 
 	// 저장된 설정 값을 JSON으로 응답하는 핸들러
 	g_server.on("/readconfig", HTTP_GET, []() {
 		loadConfiguration(); // Flash에서 최신 설정 다시 로드
-		String json = "{";
-		json += "\"ssid\":\"" + String(g_config.wifi_ssid) + "\",";
-		json += "\"host\":\"" + String(g_config.mqtt_host) + "\",";
-		json += "\"port\":" + String(g_config.mqtt_port) + ",";
-		json += "\"user\":\"" + String(g_config.mqtt_user) + "\"";
+		// 포털 루프(단일 Task)에서만 호출 → 큰 버퍼는 스택 대신 정적 영역
+		// 설정 값(이스케이프 최악 6배 포함) 1KB + 교정 곡선 2개 (각 최악 cal::FORMAT_MAX)
+		static char buf[1024 + 2 * cal::FORMAT_MAX];
+		static char curve[cal::FORMAT_MAX];
+		JsonBuf js(buf, sizeof(buf));
+		js.addS("ssid", g_config.wifi_ssid);
+		js.addS("host", g_config.mqtt_host);
+		js.addU("port", g_config.mqtt_port);
+		js.addS("user", g_config.mqtt_user);
+		js.addU("batch_k", g_config.batch_k);
+		js.addU("batch_k_max", BATCH_K_MAX);
+		js.addU("batch_ms", g_config.batch_ms);
+		// 형식화 실패(잘림) 시 필드를 빼서 잘린 곡선이 포털 입력칸에 채워지지 않도록 함
+		if (g_cal_co.format(curve, sizeof(curve))) js.addS("cal_co", curve);
+		if (g_cal_mq2.format(curve, sizeof(curve))) js.addS("cal_mq2", curve);
 		// 보안상 비밀번호는 JSON 응답에 포함하지 않습니다.
-		json += "}";
-		g_server.send(200, "application/json", json);
+		size_t n = js.finish();
+		g_server.sendHeader("Cache-Control", "no-store");
+		g_server.send(200, "application/json", n ? buf : "{}");
 	});
 
 	// 실시간 센서 상태를 JSON으로 응답하는 핸들러
@@ -798,7 +863,7 @@ void startConfigPortal() {
 			json += "\"mq2_ratio\":" + String(ratio, 4);
 		#if USE_SMOKE2
 			SMOKE2::Reading sr;
-			smoke2.read(sr);
+			smoke2.peek(sr);   // 발행용 구간 집계는 소비하지 않음
 			json += ",\"smoke2_alpha\":" + String(g_config.smoke2_alpha, 4) + ",";
 			json += "\"smoke2_ratio\":" + String(sr.ratio, 4) + ",";
 			json += "\"smoke2_score\":" + String(sr.score, 0);
@@ -816,6 +881,7 @@ void startConfigPortal() {
 	g_server.on("/update", HTTP_POST, []() {
 		g_server.sendHeader("Connection", "close");
 		g_server.send(200, "text/plain", (Update.hasError()) ? "FAIL" : "OK");
+		warm_snapshot(true); // 새 펌웨어는 RTC 변수 배치가 다를 수 있으므로 NVS에도 저장
 		ESP.restart();
 	}, []() {
 		HTTPUpload& upload = g_server.upload();
@@ -845,6 +911,8 @@ void startConfigPortal() {
 	g_server.on("/generate_204", HTTP_GET, handleRoot); // Android Captive Portal
 	g_server.onNotFound(handleRoot); // 모든 나머지 요청 처리
 
+	static const char* const kHeaders[] = { "If-None-Match" };   // serve_asset()의 304 판단
+	g_server.collectHeaders((const char**)kHeaders, 1);
 	g_server.begin();
 
 	// 설정 포털 루프
@@ -870,6 +938,7 @@ void setup(){
 
 	// 센서 초기화 전에 반드시 설정을 먼저 로드해야 합니다.
 	loadConfiguration();
+	cal_load();
 
 	leds::init();
 
@@ -877,19 +946,48 @@ void setup(){
 	// 센서 초기화 (설정 포털에서도 사용 가능하도록 앞쪽으로 이동)
 	// =================================================
 	tmr100::init();
+	warm_load();
+	{
+		power::Config pc;
+		pc.light_sleep = !(USE_ZE07 || USE_SEN0177 || USE_ICS43434);   // light sleep 중에는 UART 프레임/I2S DMA 수신 불가
+		power::begin(ENABLE_LOW_POWER ? power::LOW_POWER : power::PERFORMANCE, pc);
+	}
 	i2cInit();
 	analogReadResolution(ADC_RES_BITS);
 
 	#if USE_ADS1115 || USE_CO_ADC
 		if(!ads.begin()) Serial.println(F("[ADS1115] init failed"));
+		else {
+			// CO(A0)/MQ2(A1)/Smoke(A2)를 단발 변환으로 순회하며 백그라운드 수집 → sensorTask에서는 링 버퍼만 조회
+			uint8_t ads_mask = 0;
+			#if USE_CO_ADC
+				ads_mask |= 1u << 0;
+			#endif
+			#if USE_MQ2
+				ads_mask |= 1u << 1;
+			#endif
+			#if USE_ADS1115
+				ads_mask |= 1u << 2;
+			#endif
+			if(!ads.startBackground(ads_mask, 10, PIN_ADS_RDY)) Serial.println(F("[ADS1115] background start failed"));
+		}
 	#endif
 
 	#if USE_BME688
 		if(!bme688.begin(0x76)) Serial.println(F("[BME688] not found"));
+		else if(s_warm_ok) bme688.restoreState(s_warm.bme688);
+		#if ENABLE_LOW_POWER
+			bme688.setGasEvery(LP_BME688_GAS_EVERY);
+		#endif
+		#if ENABLE_BME688_SCAN
+			static_assert(BME68X::PROFILE_MAX <= telem::VEC_MAX, "gas_fp vector too short");
+			bme688.setProfile(BME68X::DEFAULT_PROFILE, BME68X::PROFILE_MAX);
+		#endif
 	#endif
 
 	#if USE_SGP30
 		if(!sgp30.begin()) Serial.println(F("[SGP30] not found"));
+		else jobs::restoreSgp30Baseline();   // 시계가 맞으면 첫 잡에서 기준선 복원 (소프트 리셋 후에는 즉시)
 	#endif
 
 	#if USE_SMOKE2
@@ -900,17 +998,22 @@ void setup(){
 		// Blue/IR 비율이 연기 발생 시 감소하므로, 투과형 모드로 설정합니다.
 		// 이렇게 하면 비율이 감소할 때 score가 증가하도록 부호가 반전됩니다.
 		smoke2.setTransmissiveMode(true);
-		smoke2.setPacketsToAvg(4);
-		smoke2.setEmaAlpha(0.01f);
+		smoke2.setPacketsToAvg(2); // FIFO 워터마크 2패킷(≈125ms)마다 SMOKE2 Task가 비움
+		smoke2.setEmaAlpha(0.01f / 16); // 샘플(16Hz)마다 갱신 → 기존 1초 주기 기준 시정수(약 100초) 유지
 		smoke2.setWarmupSec(20);
 		smoke2.setAdaptGuard(0.02f);
 		smoke2.setThreshold(5000.0f); // 비현실적으로 높았던 임계값을 5000으로 수정
-		smoke2.setPersist(3,5);
+		smoke2.setPersist(5,16); // 샘플 단위: ON 5샘플(≈0.3초) 연속, OFF 16샘플(≈1초) 연속
 		smoke2.setMinIrForScaling(200000.f); // IR 스케일링 하한값을 200000으로 조정
 		smoke2.setLedCurrents_mA(20.f, 20.f);
 		smoke2.enableEfuseCalibration(true); // eFuse 보정 사용
 		smoke2.begin(Wire, 0x64, g_config.smoke2_alpha); // 저장된 alpha 값으로 시작
+		if(s_warm_ok && smoke2.restoreState(s_warm.smoke2)) Serial.println(F("[WARM] SMOKE2 baseline restored"));
 		smoke2.debug_fifo_probe(Serial);
+		// FIFO 워터마크(setPacketsToAvg 패킷) 인터럽트 → 쌓인 패킷을 버스트 1회로 비움
+		if (PIN_SMOKE2_INT >= 0 && !smoke2.enableFifoInterrupt(PIN_SMOKE2_INT)) Serial.println(F("[SMOKE2] FIFO interrupt setup failed"));
+		// 샘플 단위 판정 Task (sensorTask보다 높은 우선순위, Core 0)
+		if (!smoke2.startTask(3, 0)) Serial.println(F("[SMOKE2] task start failed"));
 	#endif
 
 	#if USE_SPS30
@@ -919,6 +1022,7 @@ void setup(){
 
 	#if USE_ICS43434
 		if(!mic.begin(PIN_I2S_BCLK, PIN_I2S_LRCK, PIN_I2S_DIN)) Serial.println(F("[I2S] mic init failed"));
+		else if(!mic.startTask(MIC_WINDOW_MS, MIC_LEQ_WINDOWS)) Serial.println(F("[I2S] mic task start failed"));
 	#endif
 
 	#if USE_ZE07
@@ -935,6 +1039,7 @@ void setup(){
 		mq2cfg.v_div_ratio = 0.625f; mq2cfg.rl_ohms=5000.0f; mq2cfg.v_supply_mV=5000.0f;
 		mq2cfg.warmup_s=15; mq2cfg.calib_s=20; mq2cfg.ema_alpha=0.2f; mq2cfg.alarm_thr=0.35f;
 		mq2.begin(mq2cfg, g_config.mq2_r0);
+		if(s_warm_ok && mq2.restoreState(s_warm.mq2)) Serial.println(F("[WARM] MQ2 filter restored"));
 		Serial.printf("[MQ2] Starting with R0 = %.2f Ohms\n", g_config.mq2_r0);
 	#endif
 
@@ -952,7 +1057,12 @@ void setup(){
 	
 	if (strlen(g_config.wifi_ssid) > 0) {
 		Serial.printf("Connecting to %s", g_config.wifi_ssid);
-		WiFi.begin(g_config.wifi_ssid, g_config.wifi_pass);
+		#if ENABLE_LOW_POWER
+			WiFi.setSleep(WIFI_PS_MAX_MODEM);
+			WifiLink::beginSta(g_config.wifi_ssid, g_config.wifi_pass, LP_WIFI_LISTEN_INTERVAL);
+		#else
+			WiFi.begin(g_config.wifi_ssid, g_config.wifi_pass);
+		#endif
 		uint32_t t0 = millis();
 		while (WiFi.status() != WL_CONNECTED && (millis() - t0 < 15000)) {
 			delay(500);
@@ -973,16 +1083,35 @@ void setup(){
 	Serial.println(__ip);
 	leds::set4(1);
 
+	// 이후 Wi-Fi 재연결은 mqttTask에서 g_wifi 상태 머신이 비차단으로 처리
+	#if ENABLE_LOW_POWER
+		g_wifi.setPowerSave(LP_WIFI_LISTEN_INTERVAL);
+	#endif
+	g_wifi.begin(g_config.wifi_ssid, g_config.wifi_pass, 10000);
+
+	// SNTP 시작 (백그라운드 동기화, 텔레메트리 ts에 사용)
+	configTime(0, 0, "pool.ntp.org", "time.google.com");
+
 	g_mqtt.setBufferSize(MAX_JSON_MSG_SIZE);
  
 	//smoke2_one_shot_dump();
 	Serial.println(F("{\"status\":\"ready\"}"));
 
-	// FreeRTOS Queue 생성 (최대 5개의 메시지 저장 가능)
-	g_mqttQueue = xQueueCreate(5, MAX_JSON_MSG_SIZE);
-	if (g_mqttQueue == NULL) {
+	g_bootId = esp_random();
+	#if ENABLE_FLASH_SPOOL
+		// 단절 중 텔레메트리 보관소 (처음 마운트 실패 시 포맷)
+		if (!LittleFS.begin(true) || !g_spool.begin(LittleFS, "/spool", SPOOL_SEG_BYTES, SPOOL_MAX_SEGS)) {
+			Serial.println(F("[SPOOL] LittleFS mount failed, outage buffering disabled"));
+		}
+	#endif
+
+	// 메시지 풀 생성 (슬롯 TELEMETRY_POOL_SLOTS개, Queue에는 포인터만 저장)
+	if (!g_msgPool.begin()) {
 		Serial.println("Error creating the MQTT queue");
 	}
+	#if ENABLE_ROLLUP
+		rollup_topics_init();
+	#endif
 
 	// FreeRTOS Task 생성
 	// Core 0: 센서 데이터 수집
@@ -1004,6 +1133,10 @@ void setup(){
 		1,                  /* 우선순위 */
 		&g_mqttTaskHandle,  /* Task 핸들 */
 		1);                 /* 실행 코어 */
+
+	#if ENABLE_METRICS
+		metrics_init();
+	#endif
 }
  
 
@@ -1037,8 +1170,16 @@ void loop(){
 		g_buttonPressStartTime = 0;
 	}
 
+	#if ENABLE_METRICS
+	g_server.handleClient();   // GET /metrics
+	#endif
+
 	// loop()는 이제 비어있거나, 매우 짧은 작업만 수행합니다.
 	// 다른 모든 작업은 FreeRTOS Task에서 처리됩니다.
 	// CPU가 다른 Task에게 양보하도록 짧은 delay를 줍니다.
+	#if ENABLE_LOW_POWER
+	vTaskDelay(pdMS_TO_TICKS(50)); // 1ms마다 깨면 light sleep에 들어갈 수 없음 (버튼 5초 판정에는 충분)
+	#else
 	vTaskDelay(pdMS_TO_TICKS(1));
+	#endif
 }
@@ -0,0 +1,386 @@
+// =============================
+// File: host/bench/cycle_bench.cpp
+// =============================
+// sensorTask 사이클 벤치마크 (리눅스 호스트, 가짜 센서)
+// - 센서 잡, 발행 경로(Deadband → JSON → MsgPool), 롤업/지표와 sensorTask 루프(jobs::wait → dispatch)는
+//   스케치와 같은 src/app/Jobs.cpp를 링크해 가상 시간으로 실행합니다. 여기에는 setup()의 센서 초기화만 옮겨 둡니다.
+//   (Wi-Fi/MQTT/포털/스풀/워밍 스냅샷은 제외)
+// - ADS1115 백그라운드/SMOKE2 Task는 협력형 Task 심(host/shim/freertos)에서 실제로 돌며, 리포트에 Task별 줄로 나옵니다.
+// - 잡/사이클마다 측정: 호스트 CPU 시간, 가상 경과 시간(I2C 전송 + delay 대기), I2C 트랜잭션 수,
+//   malloc 횟수/바이트 (sensorTask 계정만 센 값, host/sim/HostSim.h)
+// - 시나리오: 20초 예열(SMOKE2 기준선) / MQ2 교정 후 발행 시작, 90~100초 연기(blue 감쇠) 이벤트, 120초 SMOKE2 재교정 요청
+//
+// 사용: cycle_bench [--seconds N] [--check] [--quiet]
+//   --quiet: 펌웨어 Serial 로그 숨김 (리포트만 출력)
+//   --check: 발행 값/경보 지연/정상 상태 할당 0회/지표 발행을 확인하고 실패 시 종료 코드 1
+#include <Arduino.h>
+#include <Wire.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/config/Pins.h"
+#include "../../src/core/I2CBus.h"
+#include "../../src/core/LEDs.h"
+#include "../../src/core/Metrics.h"
+#include "../../src/app/Jobs.h"
+
+#include "HostSim.h"
+#include "Fakes.h"
+
+// ===== 가짜 장치 =====
+static host::Adpd188Fake  f_smoke2;
+static host::Ads1115Fake  f_ads;
+static host::Sps30Fake    f_sps30;
+static host::Bme688Fake   f_bme688;
+static host::Sgp30Fake    f_sgp30;
+
+// ===== 측정 =====
+namespace {
+	typedef std::chrono::steady_clock Clock;
+
+	struct Meter {
+		uint32_t n = 0;
+		uint64_t cpu_ns = 0, cpu_max_ns = 0;
+		uint64_t virt_us = 0, virt_max_us = 0;
+		uint64_t bus_us = 0, blocked_us = 0;
+		uint64_t xfers = 0;
+		uint64_t allocs = 0, bytes = 0;
+		uint64_t steady_allocs = 0, steady_bytes = 0;
+	};
+	Meter s_meter[prof::SLOT_COUNT];
+	Meter s_setup;
+	bool  s_steady = false;                 // 예열/교정이 끝난 뒤 (할당 0회 확인 구간)
+
+	class Measure {
+		public:
+			explicit Measure(Meter &m): _m(m), _c0(host::counters()), _v0(host::nowUs()), _a0(host::allocs()), _t0(Clock::now()) {}
+			~Measure(){
+				uint64_t cpu = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _t0).count();
+				host::Allocs a = host::allocs();
+				const host::Counters &c = host::counters();
+				uint64_t virt = host::nowUs() - _v0;
+				_m.n++;
+				_m.cpu_ns += cpu; if(cpu > _m.cpu_max_ns) _m.cpu_max_ns = cpu;
+				_m.virt_us += virt; if(virt > _m.virt_max_us) _m.virt_max_us = virt;
+				_m.bus_us += c.bus_us - _c0.bus_us;
+				_m.blocked_us += c.blocked_us - _c0.blocked_us;
+				_m.xfers += c.i2c_xfers - _c0.i2c_xfers;
+				_m.allocs += a.n - _a0.n; _m.bytes += a.bytes - _a0.bytes;
+				if(s_steady){ _m.steady_allocs += a.n - _a0.n; _m.steady_bytes += a.bytes - _a0.bytes; }
+			}
+		private:
+			Meter &_m;
+			host::Counters _c0;
+			uint64_t _v0;
+			host::Allocs _a0;
+			Clock::time_point _t0;
+	};
+
+	// 잡별 측정 래퍼: 원래 잡 함수와 프로파일 슬롯을 ctx로 넘겨 Measure로 감쌈
+	struct Wrapped {
+		Scheduler::JobFn fn;
+		int8_t slot;
+	};
+	Wrapped s_wrapped[Scheduler::MAX_JOBS];
+	uint8_t s_nwrapped = 0;
+
+	uint32_t measuredJob(void* ctx, uint32_t now){
+		const Wrapped &w = *(const Wrapped*)ctx;
+		if(w.slot < 0) return w.fn(nullptr, now);
+		Measure m(s_meter[w.slot]);
+		return w.fn(nullptr, now);
+	}
+
+	int8_t addMeasured(const char* name, uint32_t period_ms, Scheduler::JobFn fn, uint32_t phase_ms, int8_t slot){
+		if(s_nwrapped >= Scheduler::MAX_JOBS) return -1;
+		Wrapped &w = s_wrapped[s_nwrapped++];
+		w.fn = fn;
+		w.slot = slot;
+		return g_sched.add(name, period_ms, measuredJob, &w, phase_ms);
+	}
+}
+
+// ===== setup() 센서 초기화 부분 =====
+static void sensors_setup(){
+	i2cbus::begin(Wire, PIN_I2C_SDA, PIN_I2C_SCL, I2C_FREQ_HZ);
+	leds::init();
+
+	#if USE_ADS1115 || USE_CO_ADC
+		if(!ads.begin()) Serial.println(F("[ADS1115] init failed"));
+		else {
+			uint8_t ads_mask = 0;
+			#if USE_CO_ADC
+				ads_mask |= 1u << 0;
+			#endif
+			#if USE_MQ2
+				ads_mask |= 1u << 1;
+			#endif
+			#if USE_ADS1115
+				ads_mask |= 1u << 2;
+			#endif
+			ads.startBackground(ads_mask, 10, PIN_ADS_RDY);
+		}
+	#endif
+	#if USE_BME688
+		if(!bme688.begin(0x76)) Serial.println(F("[BME688] not found"));
+		#if ENABLE_BME688_SCAN
+			bme688.setProfile(BME68X::DEFAULT_PROFILE, BME68X::PROFILE_MAX);
+		#endif
+	#endif
+	#if USE_SGP30
+		if(!sgp30.begin()) Serial.println(F("[SGP30] not found"));
+	#endif
+	#if USE_SMOKE2
+		smoke2.setTiaA(0x1C36);
+		smoke2.setTiaB(0x1C36);
+		smoke2.setTransmissiveMode(true);
+		smoke2.setPacketsToAvg(2);
+		smoke2.setEmaAlpha(0.01f / 16);
+		smoke2.setWarmupSec(20);
+		smoke2.setAdaptGuard(0.02f);
+		smoke2.setThreshold(5000.0f);
+		smoke2.setPersist(5,16);
+		smoke2.setMinIrForScaling(200000.f);
+		smoke2.setLedCurrents_mA(20.f, 20.f);
+		smoke2.enableEfuseCalibration(true);
+		smoke2.begin(Wire, 0x64, 0.0f);
+		smoke2.startTask(3, 0);
+	#endif
+	#if USE_SPS30
+		if(!sps30.begin(Wire, 0x69)) Serial.println(F("[SPS30] init failed"));
+	#endif
+	#if USE_ZE07
+		ze07.begin(CO_SER, CO_RX_PIN, CO_TX_PIN, 9600);
+		ze07.setQA(false);
+	#endif
+	#if USE_MQ2
+		mq2cfg.v_div_ratio = 0.625f; mq2cfg.rl_ohms=5000.0f; mq2cfg.v_supply_mV=5000.0f;
+		mq2cfg.warmup_s=15; mq2cfg.calib_s=20; mq2cfg.ema_alpha=0.2f; mq2cfg.alarm_thr=0.35f;
+		mq2.begin(mq2cfg, 0.0f);
+	#endif
+	g_msgPool.begin();
+}
+
+// ===== 시나리오 =====
+namespace {
+	constexpr uint32_t STEADY_FROM_MS  = 45000;   // MQ2 교정(15+20초) 이후
+	constexpr uint32_t SMOKE_FROM_MS   = 90000;
+	constexpr uint32_t SMOKE_UNTIL_MS  = 100000;
+	constexpr uint32_t ZE07_PHASE_MS   = 300;     // 프레임 도착 시각 (매초 +300ms)
+	constexpr uint32_t RECAL_AT_MS     = 120000;  // /calibrate_smoke2 요청 시각
+
+	uint32_t s_recal_done_ms = 0;
+	void scenario(uint32_t now){
+		f_smoke2.blue = (now >= SMOKE_FROM_MS && now < SMOKE_UNTIL_MS) ? 340000 : 400000;   // ratio 0.20 → 0.17
+		s_steady = now >= STEADY_FROM_MS;
+		#if USE_SMOKE2
+		static bool recal_sent = false;
+		if(!recal_sent && now >= RECAL_AT_MS){ smoke2.requestRecalibrate(); recal_sent = true; }
+		if(recal_sent && !s_recal_done_ms && !smoke2.recalibrating()) s_recal_done_ms = now;
+		#endif
+	}
+
+	// 수신 콜백(UART 이벤트 Task)을 대신해 도착 시각이 지난 ZE07 프레임을 주입
+	uint32_t s_ze07_next = ZE07_PHASE_MS;
+	void feed_uart(uint32_t now){
+		#if USE_ZE07
+		if((int32_t)(now - s_ze07_next) < 0) return;
+		uint8_t f[9];
+		host::ze07Frame(f, 3.5f);
+		CO_SER.host_inject(f, sizeof(f));
+		while((int32_t)(now - s_ze07_next) >= 0) s_ze07_next += 1000;
+		#else
+		(void)now;
+		#endif
+	}
+
+	// MQTT Task 대신 슬롯을 받아 내용 확인 후 반환
+	struct Seen {
+		uint32_t telemetry = 0, rollup = 0, metrics = 0, alarm_msgs = 0;
+		uint32_t first_alarm_ms = 0;
+		float pm2_5 = NAN, pm10 = NAN, temp = NAN, hum = NAN, gas_kohm = NAN;
+		float eco2 = NAN, tvoc = NAN, co_v = NAN, smoke_mv = NAN, mq2_mv = NAN, ze07 = NAN, smk_alarm = NAN;
+	} s_seen;
+
+	void jsonNum(const char* js, const char* key, float &out){
+		char k[32];
+		snprintf(k, sizeof(k), "\"%s\":", key);
+		const char* p = strstr(js, k);
+		if(p) out = strtof(p + strlen(k), nullptr);
+	}
+
+	// 슬롯은 페이로드를 복사한 뒤 바로 반환 (mqttTask도 발행 후 즉시 반환)
+	void consume(uint32_t now){
+		char js[TELEMETRY_SLOT_SIZE + 1];
+		for(;;){
+			TelemetryPool::Msg *m = g_msgPool.receive(0);
+			if(!m) break;
+			const uint8_t tag = m->tag, flags = m->flags;
+			size_t len = m->len < TELEMETRY_SLOT_SIZE ? m->len : TELEMETRY_SLOT_SIZE;
+			memcpy(js, m->data, len);
+			js[len] = '\0';
+			g_msgPool.release(m);
+
+			if(tag == MSG_TELEMETRY){
+				s_seen.telemetry++;
+				jsonNum(js, "pm2_5", s_seen.pm2_5);    jsonNum(js, "pm10", s_seen.pm10);
+				jsonNum(js, "temp", s_seen.temp);      jsonNum(js, "hum", s_seen.hum);
+				jsonNum(js, "gas_kohm", s_seen.gas_kohm);
+				jsonNum(js, "eCO2_ppm", s_seen.eco2);  jsonNum(js, "TVOC_ppb", s_seen.tvoc);
+				jsonNum(js, "CO_V", s_seen.co_v);      jsonNum(js, "Smoke_mV", s_seen.smoke_mv);
+				jsonNum(js, "mq2_mV", s_seen.mq2_mv);  jsonNum(js, "ZE07_CO_ppm", s_seen.ze07);
+				jsonNum(js, "smk_alarm", s_seen.smk_alarm);
+				if(flags & MSG_F_ALARM){
+					s_seen.alarm_msgs++;
+					if(!s_seen.first_alarm_ms) s_seen.first_alarm_ms = now;
+				}
+			} else if(tag >= MSG_ROLLUP && tag < MSG_METRICS){
+				s_seen.rollup++;
+			} else if(tag == MSG_METRICS){
+				s_seen.metrics++;
+			}
+		}
+	}
+
+	void printRow(const char* name, const Meter &m){
+		if(!m.n) return;
+		printf("%-9s %6u %9.1f %9.1f %10.1f %10.1f %8.1f %8.2f %9llu %9llu\n", name, (unsigned)m.n,
+			m.cpu_ns / 1000.0 / m.n, m.cpu_max_ns / 1000.0,
+			(double)m.virt_us / m.n, (double)m.virt_max_us,
+			(double)m.bus_us / m.n, (double)m.xfers / m.n,
+			(unsigned long long)m.allocs, (unsigned long long)m.steady_allocs);
+	}
+
+	void report(uint32_t seconds){
+		printf("\n== cycle_bench: %u s (virtual), %u telemetry / %u rollup / %u metrics messages ==\n",
+			(unsigned)seconds, (unsigned)s_seen.telemetry, (unsigned)s_seen.rollup, (unsigned)s_seen.metrics);
+		printf("cpu_us: host CPU time per run | virt_us: simulated time on target (I2C bus + delay/vTaskDelay)\n");
+		printf("bus_us: I2C transfer time per run | xfers: I2C transactions per run | allocs: malloc calls (all / after warm-up)\n\n");
+		printf("%-9s %6s %9s %9s %10s %10s %8s %8s %9s %9s\n", "slot", "n", "cpu_avg", "cpu_max", "virt_avg", "virt_max", "bus_avg", "xfers", "allocs", "steady");
+		printRow("setup", s_setup);
+		for(uint8_t i = 0; i < prof::SLOT_COUNT; i++) printRow(prof::name((prof::Slot)i), s_meter[i]);
+		host::Allocs a = host::allocsTotal();
+		printf("\nprocess allocs: %llu (%llu bytes), smoke2 FIFO overflows: %u, dropped messages: %u\n",
+			(unsigned long long)a.n, (unsigned long long)a.bytes, (unsigned)f_smoke2.overflows, (unsigned)jobs::dropped());
+		if(s_seen.first_alarm_ms)
+			printf("smoke alarm published %u ms after event start\n", (unsigned)(s_seen.first_alarm_ms - SMOKE_FROM_MS));
+
+		host::TaskInfo ti[8];
+		uint8_t nt = host::taskInfo(ti, 8);
+		if(!nt){ printf("\nno background tasks (driver task paths not exercised)\n"); return; }
+		printf("\n%-9s %8s %10s %10s %9s\n", "task", "runs", "bus_us", "xfers", "allocs");
+		for(uint8_t i = 0; i < nt; i++)
+			printf("%-9s %8u %10llu %10u %9llu\n", ti[i].name, (unsigned)ti[i].runs,
+				(unsigned long long)ti[i].acc->cnt.bus_us, (unsigned)ti[i].acc->cnt.i2c_xfers, (unsigned long long)ti[i].acc->al.n);
+	}
+
+	int s_fail = 0;
+	void expect(bool ok, const char* what){
+		if(ok) return;
+		printf("CHECK FAILED: %s\n", what);
+		s_fail++;
+	}
+	bool near(float v, float want, float tol){ return isfinite(v) && fabsf(v - want) <= tol; }
+
+	void check(uint32_t seconds){
+		expect(s_seen.telemetry > 0, "telemetry published");
+		expect(near(s_seen.pm2_5, 5.0f, 0.01f) && near(s_seen.pm10, 7.0f, 0.01f), "SPS30 pm2_5/pm10");
+		expect(near(s_seen.temp, 23.5f, 0.01f) && near(s_seen.hum, 41.0f, 0.01f), "BME688 temp/hum");
+		expect(near(s_seen.gas_kohm, 120.0f, 0.01f), "BME688 gas_kohm");
+		expect(near(s_seen.eco2, 450.0f, 0.5f) && near(s_seen.tvoc, 12.0f, 0.5f), "SGP30 eCO2/TVOC");
+		expect(near(s_seen.co_v, 1.2f, 0.01f), "ADS1115 CO_V");
+		expect(near(s_seen.mq2_mv, 1800.0f, 5.0f), "ADS1115 mq2_mV");
+		expect(near(s_seen.smoke_mv, 600.0f, 5.0f), "ADS1115 Smoke_mV");
+		expect(near(s_seen.ze07, 3.5f, 0.05f), "ZE07 CO ppm");
+		if(seconds * 1000 > SMOKE_UNTIL_MS + 5000){
+			expect(s_seen.alarm_msgs > 0, "smoke alarm published");
+			expect(s_seen.first_alarm_ms >= SMOKE_FROM_MS && s_seen.first_alarm_ms - SMOKE_FROM_MS < 1000, "smoke alarm latency < 1 s");
+			expect(near(s_seen.smk_alarm, 0.0f, 0.0f), "smoke alarm cleared after event");
+		}
+		#if USE_SMOKE2
+		if(seconds * 1000 > RECAL_AT_MS + 25000){
+			// 예열 20초(320샘플) 후 완료, 기준선은 blue/ir = 0.2
+			expect(s_recal_done_ms >= RECAL_AT_MS + 19000 && s_recal_done_ms < RECAL_AT_MS + 22000, "SMOKE2 recalibration completes after warm-up");
+			expect(near(smoke2.getAlpha(), 0.2f, 0.002f), "SMOKE2 recalibrated alpha");
+		}
+		#endif
+		#if ENABLE_METRICS
+		if(seconds * 1000 >= METRICS_PERIOD_MS + 1000)
+			expect(s_seen.metrics > 0 && metrics::hist(prof::SLOT_CYCLE).n > 0, "metrics published");
+		#endif
+		#if USE_ADS1115 || USE_CO_ADC
+		expect(ads.background() && ads.samples(0) + ads.samples(1) + ads.samples(2) > 0, "ADS1115 background task fills the ring");
+		#endif
+		#if USE_SMOKE2
+		expect(smoke2.taskRunning(), "SMOKE2 task running");
+		#endif
+		host::TaskInfo ti[8];
+		uint8_t nt = host::taskInfo(ti, 8);
+		for(uint8_t i = 0; i < nt; i++){
+			char what[64];
+			snprintf(what, sizeof(what), "task %s ran", ti[i].name);
+			expect(ti[i].runs > 0 && ti[i].acc->cnt.i2c_xfers > 0, what);
+			snprintf(what, sizeof(what), "no heap allocation in task %s", ti[i].name);
+			expect(ti[i].acc->al.n == 0, what);
+		}
+		expect(f_smoke2.overflows == 0, "no SMOKE2 FIFO overflow");
+		expect(jobs::dropped() == 0, "no dropped messages");
+		for(uint8_t i = 0; i < prof::SLOT_COUNT; i++){
+			if(s_meter[i].steady_allocs == 0) continue;
+			char what[64];
+			snprintf(what, sizeof(what), "no heap allocation after warm-up (%s)", prof::name((prof::Slot)i));
+			expect(false, what);
+		}
+	}
+}
+
+int main(int argc, char** argv){
+	uint32_t seconds = 180;
+	bool do_check = false, quiet = false;
+	for(int i = 1; i < argc; i++){
+		if(!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = (uint32_t)atoi(argv[++i]);
+		else if(!strcmp(argv[i], "--check")) do_check = true;
+		else if(!strcmp(argv[i], "--quiet")) quiet = true;
+		else { fprintf(stderr, "usage: %s [--seconds N] [--check] [--quiet]\n", argv[0]); return 2; }
+	}
+
+	host::attachI2C(0x64, &f_smoke2);
+	host::attachI2C(0x48, &f_ads);
+	host::attachI2C(0x69, &f_sps30);
+	host::attachI2C(0x76, &f_bme688);
+	host::attachI2C(0x58, &f_sgp30);
+	f_ads.volts[0] = 0.6f;    // CO (외부 분압 x2 → 1.2V)
+	f_ads.volts[1] = 0.9f;    // MQ2
+	f_ads.volts[2] = 0.3f;    // Smoke aux
+
+	Serial.begin(115200);
+	host::setConsole(!quiet);
+	{
+		Measure m(s_setup);
+		sensors_setup();
+	}
+	jobs::addSensors(addMeasured);
+	jobs::addPublish(addMeasured);
+
+	// sensorTask 루프
+	const uint32_t end_ms = millis() + seconds * 1000;
+	while((int32_t)(millis() - end_ms) < 0){
+		jobs::wait();
+		uint32_t now = millis();
+		scenario(now);
+		feed_uart(now);
+		{
+			Measure m(s_meter[prof::SLOT_CYCLE]);
+			jobs::dispatch();
+		}
+		consume(millis());
+	}
+
+	report(seconds);
+	if(!do_check) return 0;
+	check(seconds);
+	printf("%s\n", s_fail ? "CHECK: FAIL" : "CHECK: OK");
+	return s_fail ? 1 : 0;
+}
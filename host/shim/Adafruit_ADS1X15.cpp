@@ -0,0 +1,68 @@
+// =============================
+// File: host/shim/Adafruit_ADS1X15.cpp
+// =============================
+#include <Adafruit_ADS1X15.h>
+
+bool Adafruit_ADS1X15::begin(uint8_t i2c_addr, TwoWire* wire){
+	_wire = wire; _addr = i2c_addr;
+	_wire->beginTransmission(_addr);          // Adafruit_I2CDevice::begin()의 주소 탐지
+	return _wire->endTransmission() == 0;
+}
+
+int16_t Adafruit_ADS1X15::readADC_SingleEnded(uint8_t channel){
+	if(channel > 3) return 0;
+	startADCReading(MUX_BY_CHANNEL[channel], /*continuous=*/false);
+	while(!conversionComplete());
+	return getLastConversionResults();
+}
+
+void Adafruit_ADS1X15::startADCReading(uint16_t mux, bool continuous){
+	uint16_t config = ADS1X15_REG_CONFIG_CQUE_1CONV;
+	config |= continuous ? ADS1X15_REG_CONFIG_MODE_CONTIN : ADS1X15_REG_CONFIG_MODE_SINGLE;
+	config |= m_gain;
+	config |= m_dataRate;
+	config |= mux;
+	config |= ADS1X15_REG_CONFIG_OS_SINGLE;
+	writeRegister(ADS1X15_REG_POINTER_CONFIG, config);
+	writeRegister(ADS1X15_REG_POINTER_HITHRESH, 0x8000);
+	writeRegister(ADS1X15_REG_POINTER_LOWTHRESH, 0x0000);
+}
+
+bool Adafruit_ADS1X15::conversionComplete(){
+	return (readRegister(ADS1X15_REG_POINTER_CONFIG) & ADS1X15_REG_CONFIG_OS_MASK) != 0;
+}
+
+int16_t Adafruit_ADS1X15::getLastConversionResults(){
+	uint16_t res = readRegister(ADS1X15_REG_POINTER_CONVERT) >> m_bitShift;
+	return (int16_t)res;
+}
+
+float Adafruit_ADS1X15::computeVolts(int16_t counts){
+	float fsRange;
+	switch(m_gain){
+		case GAIN_TWOTHIRDS: fsRange = 6.144f; break;
+		case GAIN_ONE:       fsRange = 4.096f; break;
+		case GAIN_TWO:       fsRange = 2.048f; break;
+		case GAIN_FOUR:      fsRange = 1.024f; break;
+		case GAIN_EIGHT:     fsRange = 0.512f; break;
+		default:             fsRange = 0.256f; break;
+	}
+	return counts * (fsRange / (32768 >> m_bitShift));
+}
+
+void Adafruit_ADS1X15::writeRegister(uint8_t reg, uint16_t value){
+	_wire->beginTransmission(_addr);
+	_wire->write(reg);
+	_wire->write((uint8_t)(value >> 8));
+	_wire->write((uint8_t)(value & 0xFF));
+	_wire->endTransmission();
+}
+
+uint16_t Adafruit_ADS1X15::readRegister(uint8_t reg){
+	_wire->beginTransmission(_addr);
+	_wire->write(reg);
+	_wire->endTransmission();
+	if(_wire->requestFrom(_addr, (uint8_t)2) != 2) return 0xFFFF;   // 장치 없음: 폴링 루프가 멈추지 않도록 OS=1
+	uint8_t hi = (uint8_t)_wire->read(), lo = (uint8_t)_wire->read();
+	return (uint16_t)((hi << 8) | lo);
+}
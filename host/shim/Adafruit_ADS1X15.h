@@ -0,0 +1,74 @@
+// =============================
+// File: host/shim/Adafruit_ADS1X15.h
+// =============================
+#pragma once
+#include <Wire.h>
+
+// Adafruit_ADS1X15 2.x 호환 심 (ADS1115만). 레지스터 접근 순서는 원본 라이브러리와 같습니다.
+//   startADCReading(): CONFIG 쓰기 → HI_THRESH=0x8000 → LO_THRESH=0x0000 (ALERT/RDY를 변환 완료 신호로)
+//   readADC_SingleEnded(): 단발 변환 시작 후 CONFIG.OS 비트를 대기 없이 폴링 (원본과 같이 busy-wait)
+#define ADS1X15_REG_POINTER_CONVERT   0x00
+#define ADS1X15_REG_POINTER_CONFIG    0x01
+#define ADS1X15_REG_POINTER_LOWTHRESH 0x02
+#define ADS1X15_REG_POINTER_HITHRESH  0x03
+
+#define ADS1X15_REG_CONFIG_OS_MASK    0x8000
+#define ADS1X15_REG_CONFIG_OS_SINGLE  0x8000
+#define ADS1X15_REG_CONFIG_MUX_MASK   0x7000
+#define ADS1X15_REG_CONFIG_MODE_MASK  0x0100
+#define ADS1X15_REG_CONFIG_MODE_CONTIN 0x0000
+#define ADS1X15_REG_CONFIG_MODE_SINGLE 0x0100
+#define ADS1X15_REG_CONFIG_RATE_MASK  0x00E0
+#define ADS1X15_REG_CONFIG_CQUE_1CONV 0x0000
+#define ADS1X15_REG_CONFIG_CQUE_NONE  0x0003
+
+#define RATE_ADS1115_8SPS   0x0000
+#define RATE_ADS1115_16SPS  0x0020
+#define RATE_ADS1115_32SPS  0x0040
+#define RATE_ADS1115_64SPS  0x0060
+#define RATE_ADS1115_128SPS 0x0080
+#define RATE_ADS1115_250SPS 0x00A0
+#define RATE_ADS1115_475SPS 0x00C0
+#define RATE_ADS1115_860SPS 0x00E0
+
+typedef enum {
+	GAIN_TWOTHIRDS = 0x0000,
+	GAIN_ONE       = 0x0200,
+	GAIN_TWO       = 0x0400,
+	GAIN_FOUR      = 0x0600,
+	GAIN_EIGHT     = 0x0800,
+	GAIN_SIXTEEN   = 0x0A00
+} adsGain_t;
+
+constexpr uint16_t MUX_BY_CHANNEL[] = { 0x4000, 0x5000, 0x6000, 0x7000 };
+
+class Adafruit_ADS1X15 {
+	public:
+		bool begin(uint8_t i2c_addr = 0x48, TwoWire* wire = &Wire);
+		void setGain(adsGain_t gain){ m_gain = gain; }
+		adsGain_t getGain(){ return m_gain; }
+		void setDataRate(uint16_t rate){ m_dataRate = rate; }
+		uint16_t getDataRate(){ return m_dataRate; }
+
+		int16_t readADC_SingleEnded(uint8_t channel);
+		void startADCReading(uint16_t mux, bool continuous);
+		bool conversionComplete();
+		int16_t getLastConversionResults();
+		float computeVolts(int16_t counts);
+
+	protected:
+		uint8_t   m_bitShift = 0;
+		adsGain_t m_gain = GAIN_TWOTHIRDS;
+		uint16_t  m_dataRate = RATE_ADS1115_128SPS;
+
+	private:
+		void writeRegister(uint8_t reg, uint16_t value);
+		uint16_t readRegister(uint8_t reg);
+		TwoWire* _wire = nullptr;
+		uint8_t  _addr = 0x48;
+};
+
+class Adafruit_ADS1115 : public Adafruit_ADS1X15 {
+	public:
+		Adafruit_ADS1115(){ m_bitShift = 0; m_gain = GAIN_TWOTHIRDS; m_dataRate = RATE_ADS1115_128SPS; }
+};
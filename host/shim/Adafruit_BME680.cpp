@@ -0,0 +1,107 @@
+// =============================
+// File: host/shim/Adafruit_BME680.cpp
+// =============================
+#include <Adafruit_BME680.h>
+
+bool Adafruit_BME680::begin(uint8_t addr, bool initSettings){
+	_addr = addr;
+	uint8_t id = 0;
+	if(!writeReg_(REG_RESET, 0xB6)) return false;    // 소프트 리셋
+	delay(10);
+	if(!readRegs_(REG_CHIP_ID, &id, 1) || id != CHIP_ID) return false;
+	if(initSettings){
+		_os_t = BME680_OS_8X; _os_h = BME680_OS_2X; _os_p = BME680_OS_4X; _filter = BME680_FILTER_SIZE_3;
+		writeConf_();
+		setGasHeater(320, 150);
+	}
+	return true;
+}
+
+bool Adafruit_BME680::writeConf_(){
+	bool ok = writeReg_(REG_CTRL_HUM, _os_h & 0x07);
+	ok = ok && writeReg_(REG_CONFIG, (uint8_t)((_filter & 0x07) << 2));
+	ok = ok && writeReg_(REG_CTRL_MEAS, (uint8_t)(((_os_t & 0x07) << 5) | ((_os_p & 0x07) << 2)));   // sleep 모드
+	return ok;
+}
+
+bool Adafruit_BME680::setGasHeater(uint16_t heaterTemp, uint16_t heaterTime){
+	_gas_on = heaterTemp && heaterTime;
+	_heat_ms = _gas_on ? heaterTime : 0;
+	bool ok = true;
+	if(_gas_on){
+		// 실제 칩은 보정 계수로 res_heat 코드와 (배수, 시간) 인코딩을 계산하지만 심은 값만 전달
+		ok = writeReg_(REG_RES_HEAT0, (uint8_t)(heaterTemp / 2));
+		ok = ok && writeReg_(REG_GAS_WAIT0, (uint8_t)(heaterTime > 63 ? 0x40 | (heaterTime / 4 > 63 ? 63 : heaterTime / 4) : heaterTime));
+	}
+	ok = ok && writeReg_(REG_CTRL_GAS0, _gas_on ? 0x00 : 0x08);   // heat_off
+	ok = ok && writeReg_(REG_CTRL_GAS1, _gas_on ? 0x10 : 0x00);   // run_gas, nb_conv=0
+	return ok;
+}
+
+// bme68x_get_meas_dur(): 오버샘플링 사이클 × 1963us + TPH 전환 + 가스 측정 + 기상 시간
+uint32_t Adafruit_BME680::measDurUs_() const {
+	static const uint8_t cycles[6] = { 0, 1, 2, 4, 8, 16 };
+	auto cyc = [](uint8_t os){ return os < 6 ? cycles[os] : 16; };
+	uint32_t us = (uint32_t)(cyc(_os_t) + cyc(_os_p) + cyc(_os_h)) * 1963;
+	us += 477 * 4;
+	us += 477 * 5;
+	us += 1000;
+	return us;
+}
+
+unsigned long Adafruit_BME680::beginReading(){
+	if(_meas_start != 0) return _meas_start + _meas_period;
+	if(!writeReg_(REG_CTRL_MEAS, (uint8_t)(((_os_t & 0x07) << 5) | ((_os_p & 0x07) << 2) | 0x01))) return 0;   // forced
+	uint32_t period_us = measDurUs_() + (uint32_t)_heat_ms * 1000;
+	_meas_start = millis();
+	if(_meas_start == 0) _meas_start = 1;            // 0은 "측정 안 함" 표시
+	_meas_period = period_us / 1000;
+	return _meas_start + _meas_period;
+}
+
+int Adafruit_BME680::remainingReadingMillis(){
+	if(_meas_start == 0) return -1;
+	int remaining = (int)(_meas_period - (millis() - _meas_start));
+	return remaining < 0 ? 0 : remaining;
+}
+
+bool Adafruit_BME680::endReading(){
+	unsigned long meas_end = beginReading();
+	if(meas_end == 0) return false;
+	int remaining = remainingReadingMillis();
+	if(remaining > 0) delay((unsigned)remaining * 2);
+	_meas_start = 0;
+	_meas_period = 0;
+
+	// bme68x_get_data(): new_data가 설 때까지 최대 5회 (10ms 간격) 재시도
+	uint8_t f[FIELD_LEN];
+	for(uint8_t tries = 0; tries < 5; tries++){
+		if(!readRegs_(REG_FIELD0, f, FIELD_LEN)) return false;
+		if(f[0] & 0x80) break;
+		delay(10);
+	}
+	if(!(f[0] & 0x80)) return false;
+
+	temperature = (int16_t)((f[1] << 8) | f[2]) / 100.0f;
+	humidity    = (uint16_t)((f[3] << 8) | f[4]) / 100.0f;
+	pressure    = ((uint32_t)f[5] << 24) | ((uint32_t)f[6] << 16) | ((uint32_t)f[7] << 8) | f[8];
+	uint32_t g  = ((uint32_t)f[9] << 24) | ((uint32_t)f[10] << 16) | ((uint32_t)f[11] << 8) | f[12];
+	gas_resistance = (f[13] & 0x30) ? g : 0;        // gas_valid | heat_stab
+	return true;
+}
+
+bool Adafruit_BME680::writeReg_(uint8_t reg, uint8_t v){
+	_wire->beginTransmission(_addr);
+	_wire->write(reg);
+	_wire->write(v);
+	return _wire->endTransmission() == 0;
+}
+
+bool Adafruit_BME680::readRegs_(uint8_t reg, uint8_t* out, uint8_t n){
+	_wire->beginTransmission(_addr);
+	_wire->write(reg);
+	if(_wire->endTransmission(false) != 0) return false;
+	if(_wire->requestFrom(_addr, n) != n) return false;
+	for(uint8_t i = 0; i < n; i++) out[i] = (uint8_t)_wire->read();
+	return true;
+}
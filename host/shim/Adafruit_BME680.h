@@ -0,0 +1,75 @@
+// =============================
+// File: host/shim/Adafruit_BME680.h
+// =============================
+#pragma once
+#include <Wire.h>
+
+// Adafruit_BME680 2.x 호환 심
+// - 변환 시간(beginReading 반환값)은 Bosch bme68x_get_meas_dur() 식 + 히터 시간으로 원본과 같게 계산합니다.
+// - endReading()은 원본과 같이 남은 시간의 2배를 delay()합니다.
+// - 보정 계수(calib) 읽기/보상 계산은 생략하고, 결과 블록(0x1D부터 15바이트)은 단순화한 인코딩으로 읽습니다.
+//   (host/sim/Fakes.h의 Bme688Fake 참조)
+#define BME680_OS_NONE 0
+#define BME680_OS_1X   1
+#define BME680_OS_2X   2
+#define BME680_OS_4X   3
+#define BME680_OS_8X   4
+#define BME680_OS_16X  5
+
+#define BME680_FILTER_SIZE_0   0
+#define BME680_FILTER_SIZE_1   1
+#define BME680_FILTER_SIZE_3   2
+#define BME680_FILTER_SIZE_7   3
+#define BME680_FILTER_SIZE_15  4
+#define BME680_FILTER_SIZE_31  5
+#define BME680_FILTER_SIZE_63  6
+#define BME680_FILTER_SIZE_127 7
+
+class Adafruit_BME680 {
+	public:
+		static constexpr uint8_t REG_FIELD0    = 0x1D;
+		static constexpr uint8_t FIELD_LEN     = 15;
+		static constexpr uint8_t REG_RES_HEAT0 = 0x5A;
+		static constexpr uint8_t REG_GAS_WAIT0 = 0x64;
+		static constexpr uint8_t REG_CTRL_GAS0 = 0x70;
+		static constexpr uint8_t REG_CTRL_GAS1 = 0x71;
+		static constexpr uint8_t REG_CTRL_HUM  = 0x72;
+		static constexpr uint8_t REG_CTRL_MEAS = 0x74;
+		static constexpr uint8_t REG_CONFIG    = 0x75;
+		static constexpr uint8_t REG_CHIP_ID   = 0xD0;
+		static constexpr uint8_t REG_RESET     = 0xE0;
+		static constexpr uint8_t CHIP_ID       = 0x61;
+
+		explicit Adafruit_BME680(TwoWire* wire = &Wire): _wire(wire) {}
+		bool begin(uint8_t addr = 0x77, bool initSettings = true);
+
+		bool setTemperatureOversampling(uint8_t os){ _os_t = os; return writeConf_(); }
+		bool setHumidityOversampling(uint8_t os){ _os_h = os; return writeConf_(); }
+		bool setPressureOversampling(uint8_t os){ _os_p = os; return writeConf_(); }
+		bool setIIRFilterSize(uint8_t fs){ _filter = fs; return writeConf_(); }
+		bool setGasHeater(uint16_t heaterTemp, uint16_t heaterTime);
+
+		bool performReading(){ return endReading(); }
+		unsigned long beginReading();
+		bool endReading();
+		int remainingReadingMillis();
+
+		float    temperature = 0;
+		float    humidity = 0;
+		uint32_t pressure = 0;
+		uint32_t gas_resistance = 0;
+
+	private:
+		bool writeReg_(uint8_t reg, uint8_t v);
+		bool readRegs_(uint8_t reg, uint8_t* out, uint8_t n);
+		bool writeConf_();
+		uint32_t measDurUs_() const;
+
+		TwoWire* _wire;
+		uint8_t  _addr = 0x77;
+		uint8_t  _os_t = BME680_OS_8X, _os_h = BME680_OS_2X, _os_p = BME680_OS_4X, _filter = BME680_FILTER_SIZE_3;
+		bool     _gas_on = false;
+		uint16_t _heat_ms = 0;
+		unsigned long _meas_start = 0;
+		unsigned long _meas_period = 0;
+};
@@ -0,0 +1,69 @@
+// =============================
+// File: host/shim/Adafruit_SGP30.cpp
+// =============================
+#include <Adafruit_SGP30.h>
+#include "../sim/HostSim.h"
+
+bool Adafruit_SGP30::begin(TwoWire* wire, bool initSensor){
+	_wire = wire;
+	if(!command_(CMD_SERIAL, nullptr, 0, 10, serialnumber, 3)) return false;
+	uint16_t features = 0;
+	if(!command_(CMD_FEATURES, nullptr, 0, 10, &features, 1)) return false;
+	if((features & 0xF0) != 0x20) return false;
+	return initSensor ? IAQinit() : true;
+}
+
+bool Adafruit_SGP30::IAQinit(){ return command_(CMD_IAQINIT, nullptr, 0, 10, nullptr, 0); }
+
+bool Adafruit_SGP30::IAQmeasure(){
+	uint16_t r[2];
+	if(!command_(CMD_MEASURE, nullptr, 0, 12, r, 2)) return false;
+	eCO2 = r[0];
+	TVOC = r[1];
+	return true;
+}
+
+bool Adafruit_SGP30::getIAQBaseline(uint16_t* eco2_base, uint16_t* tvoc_base){
+	uint16_t r[2];
+	if(!command_(CMD_GETBASE, nullptr, 0, 10, r, 2)) return false;
+	*eco2_base = r[0];
+	*tvoc_base = r[1];
+	return true;
+}
+
+// 원본과 같이 TVOC 기준선이 먼저 전송됨
+bool Adafruit_SGP30::setIAQBaseline(uint16_t eco2_base, uint16_t tvoc_base){
+	uint16_t a[2] = { tvoc_base, eco2_base };
+	return command_(CMD_SETBASE, a, 2, 10, nullptr, 0);
+}
+
+bool Adafruit_SGP30::setHumidity(uint32_t absolute_humidity){
+	if(absolute_humidity > 256000) return false;
+	uint16_t ah = (uint16_t)(((uint64_t)absolute_humidity * 256 * 16777) >> 24);
+	return command_(CMD_HUMIDITY, &ah, 1, 10, nullptr, 0);
+}
+
+bool Adafruit_SGP30::command_(uint16_t cmd, const uint16_t* args, uint8_t nargs, uint16_t delay_ms, uint16_t* out, uint8_t nout){
+	if(!_wire) return false;
+	_wire->beginTransmission(I2C_ADDR);
+	_wire->write((uint8_t)(cmd >> 8));
+	_wire->write((uint8_t)cmd);
+	for(uint8_t i = 0; i < nargs; i++){
+		uint8_t w[2] = { (uint8_t)(args[i] >> 8), (uint8_t)args[i] };
+		_wire->write(w, 2);
+		_wire->write(host::crc8(w, 2));
+	}
+	if(_wire->endTransmission() != 0) return false;
+	delay(delay_ms);
+	if(!nout) return true;
+
+	size_t len = (size_t)nout * 3;
+	if(_wire->requestFrom(I2C_ADDR, len, true) != len) return false;
+	for(uint8_t i = 0; i < nout; i++){
+		uint8_t w[3];
+		for(uint8_t k = 0; k < 3; k++) w[k] = (uint8_t)_wire->read();
+		if(host::crc8(w, 2) != w[2]) return false;
+		out[i] = (uint16_t)((w[0] << 8) | w[1]);
+	}
+	return true;
+}
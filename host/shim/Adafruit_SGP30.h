@@ -0,0 +1,34 @@
+// =============================
+// File: host/shim/Adafruit_SGP30.h
+// =============================
+#pragma once
+#include <Wire.h>
+
+// Adafruit_SGP30 2.x 호환 심 (명령 코드/지연/CRC는 원본 라이브러리와 같음)
+class Adafruit_SGP30 {
+	public:
+		static constexpr uint8_t  I2C_ADDR     = 0x58;
+		static constexpr uint16_t CMD_SERIAL   = 0x3682;
+		static constexpr uint16_t CMD_FEATURES = 0x202F;
+		static constexpr uint16_t CMD_IAQINIT  = 0x2003;
+		static constexpr uint16_t CMD_MEASURE  = 0x2008;
+		static constexpr uint16_t CMD_GETBASE  = 0x2015;
+		static constexpr uint16_t CMD_SETBASE  = 0x201E;
+		static constexpr uint16_t CMD_HUMIDITY = 0x2061;
+
+		bool begin(TwoWire* wire = &Wire, bool initSensor = true);
+		bool IAQinit();
+		bool IAQmeasure();
+		bool getIAQBaseline(uint16_t* eco2_base, uint16_t* tvoc_base);
+		bool setIAQBaseline(uint16_t eco2_base, uint16_t tvoc_base);
+		bool setHumidity(uint32_t absolute_humidity);
+
+		uint16_t TVOC = 0;
+		uint16_t eCO2 = 0;
+		uint16_t serialnumber[3] = {};
+
+	private:
+		bool command_(uint16_t cmd, const uint16_t* args, uint8_t nargs, uint16_t delay_ms, uint16_t* out, uint8_t nout);
+
+		TwoWire* _wire = nullptr;
+};
@@ -0,0 +1,114 @@
+// =============================
+// File: host/shim/Arduino.cpp
+// =============================
+#include <Arduino.h>
+#include <chrono>
+#include "../sim/HostSim.h"
+
+HardwareSerial Serial(0);
+EspClass ESP;
+
+// ===== 시간 =====
+uint32_t millis(){ return (uint32_t)(host::nowUs() / 1000); }
+uint32_t micros(){ return (uint32_t)host::nowUs(); }
+void delay(uint32_t ms){ host::blockUs((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us){ host::blockUs(us); }
+void yield(){}
+
+// ===== GPIO =====
+namespace {
+	constexpr int PIN_MAX = 64;
+	int s_level[PIN_MAX];
+}
+
+void pinMode(int pin, int mode){
+	if(pin >= 0 && pin < PIN_MAX && mode == INPUT_PULLUP) s_level[pin] = HIGH;
+}
+void digitalWrite(int pin, int level){ if(pin >= 0 && pin < PIN_MAX) s_level[pin] = level; }
+int  digitalRead(int pin){ return (pin >= 0 && pin < PIN_MAX) ? s_level[pin] : LOW; }
+void analogReadResolution(int){}
+void attachInterrupt(int, void (*)(), int){}
+void attachInterruptArg(int, void (*)(void*), void*, int){}
+void detachInterrupt(int){}
+
+// ===== Print =====
+size_t Print::print(long v, int base){
+	if(base == DEC) return printf("%ld", v);
+	return print((unsigned long)v, base);
+}
+
+size_t Print::print(unsigned long v, int base){
+	if(base == HEX) return printf("%lX", v);
+	if(base == DEC) return printf("%lu", v);
+	char tmp[sizeof(long) * 8 + 1]; uint8_t n = 0;
+	if(base < 2) base = 2;
+	do { uint8_t d = v % base; tmp[n++] = (char)(d < 10 ? '0' + d : 'A' + d - 10); v /= base; } while(v);
+	size_t w = 0;
+	while(n) w += write((uint8_t)tmp[--n]);
+	return w;
+}
+
+size_t Print::print(double v, int digits){
+	return printf("%.*f", digits, v);
+}
+
+size_t Print::printf(const char* fmt, ...){
+	char buf[256];
+	va_list ap;
+	va_start(ap, fmt);
+	int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+	if(n < 0) return 0;
+	if((size_t)n < sizeof(buf)) return write((const uint8_t*)buf, (size_t)n);
+
+	// 긴 출력 (보드 코어도 이 경우에만 힙 버퍼 사용)
+	char* big = (char*)malloc((size_t)n + 1);
+	if(!big) return 0;
+	va_start(ap, fmt);
+	vsnprintf(big, (size_t)n + 1, fmt, ap);
+	va_end(ap);
+	size_t w = write((const uint8_t*)big, (size_t)n);
+	free(big);
+	return w;
+}
+
+// ===== HardwareSerial =====
+void HardwareSerial::begin(unsigned long baud, uint32_t, int, int){ _baud = baud; _head = _tail = 0; }
+
+size_t HardwareSerial::write(uint8_t c){ return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t* p, size_t n){
+	_tx += (uint32_t)n;
+	if(_nr == 0 && host::console()) fwrite(p, 1, n, stdout);
+	return n;
+}
+
+int HardwareSerial::read(){
+	if(_head == _tail) return -1;
+	uint8_t c = _rx[_tail];
+	_tail = (_tail + 1) & (RX_CAP - 1);
+	return c;
+}
+
+int HardwareSerial::peek(){ return _head == _tail ? -1 : _rx[_tail]; }
+
+void HardwareSerial::host_inject(const uint8_t* p, size_t n){
+	for(size_t i = 0; i < n; i++){
+		size_t next = (_head + 1) & (RX_CAP - 1);
+		if(next == _tail) break;               // RX 버퍼 가득 참 → 버림 (보드와 같음)
+		_rx[_head] = p[i];
+		_head = next;
+	}
+	if(_cb) _cb();
+}
+
+// ===== ESP =====
+uint32_t EspClass::getFreeHeap(){ return 200 * 1024; }
+uint32_t EspClass::getMinFreeHeap(){ return 180 * 1024; }
+uint32_t EspClass::getMaxAllocHeap(){ return 110 * 1024; }
+
+uint32_t EspClass::getCycleCount(){
+	static const auto t0 = std::chrono::steady_clock::now();
+	uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+	return (uint32_t)(ns * getCpuFreqMHz() / 1000);
+}
@@ -0,0 +1,153 @@
+// =============================
+// File: host/shim/Arduino.h
+// =============================
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+// 호스트 빌드용 Arduino-ESP32 코어 심 (src/core, src/drivers가 쓰는 부분만)
+// 시간 함수는 host/sim/HostSim.h의 가상 시계를 따릅니다.
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define RTC_DATA_ATTR
+#define PROGMEM
+#define PGM_P const char*
+#define F(x) (x)
+
+#define HIGH 1
+#define LOW  0
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+#define RISING   0x01
+#define FALLING  0x02
+#define CHANGE   0x03
+#define DEC 10
+#define HEX 16
+#define SERIAL_8N1 0x800001c
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+using std::min;
+using std::max;
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+// ===== 시간 (가상 시계) =====
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// ===== GPIO (레벨만 보관, 인터럽트는 등록만) =====
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+int  digitalRead(int pin);
+void analogReadResolution(int bits);
+inline int digitalPinToInterrupt(int pin){ return pin; }
+void attachInterrupt(int irq, void (*fn)(), int mode);
+void attachInterruptArg(int irq, void (*fn)(void*), void* arg, int mode);
+void detachInterrupt(int irq);
+
+// ===== Print / Stream =====
+class Print {
+	public:
+		virtual ~Print(){}
+		virtual size_t write(uint8_t c) = 0;
+		virtual size_t write(const uint8_t* p, size_t n){ size_t r = 0; while(n--) r += write(*p++); return r; }
+		size_t write(const char* s){ return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+
+		size_t print(const char* s){ return write(s); }
+		size_t print(char c){ return write((uint8_t)c); }
+		size_t print(int v, int base = DEC){ return print((long)v, base); }
+		size_t print(unsigned v, int base = DEC){ return print((unsigned long)v, base); }
+		size_t print(long v, int base = DEC);
+		size_t print(unsigned long v, int base = DEC);
+		size_t print(double v, int digits = 2);
+
+		size_t println(){ return write("\r\n"); }
+		template <class T> size_t println(T v){ size_t n = print(v); return n + println(); }
+		template <class T> size_t println(T v, int f){ size_t n = print(v, f); return n + println(); }
+
+		size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+		virtual void flush(){}
+};
+
+class Stream : public Print {
+	public:
+		virtual int available() = 0;
+		virtual int read() = 0;
+		virtual int peek() = 0;
+		void setTimeout(unsigned long ms){ _timeout = ms; }
+		size_t readBytes(uint8_t* p, size_t n){
+			size_t i = 0;
+			while(i < n && available() > 0) p[i++] = (uint8_t)read();
+			return i;
+		}
+	protected:
+		unsigned long _timeout = 1000;
+};
+
+// UART: RX는 host_inject()로 넣은 바이트 (넣을 때마다 onReceive 콜백 = UART 이벤트 Task 역할)
+//       TX는 tx_count()만 세고 버림 (Serial은 host::console()이 켜져 있으면 stdout으로 출력)
+class HardwareSerial : public Stream {
+	public:
+		explicit HardwareSerial(int uart_nr): _nr(uart_nr) {}
+		void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int rx = -1, int tx = -1);
+		void end(){}
+		size_t setRxBufferSize(size_t n){ return n; }
+		void onReceive(std::function<void(void)> cb, bool onlyOnTimeout = false){ _cb = cb; (void)onlyOnTimeout; }
+
+		size_t write(uint8_t c) override;
+		size_t write(const uint8_t* p, size_t n) override;
+		using Print::write;
+		int available() override { return (int)((_head - _tail) & (RX_CAP - 1)); }
+		int read() override;
+		int peek() override;
+		void flush() override {}
+
+		// 호스트 전용: 수신 바이트 주입 (가상 시각은 호출 측이 관리)
+		void host_inject(const uint8_t* p, size_t n);
+		uint32_t tx_count() const { return _tx; }
+		unsigned long baud() const { return _baud; }
+
+	private:
+		static constexpr size_t RX_CAP = 256;
+		int      _nr;
+		unsigned long _baud = 0;
+		uint8_t  _rx[RX_CAP];
+		size_t   _head = 0, _tail = 0;
+		uint32_t _tx = 0;
+		std::function<void(void)> _cb;
+};
+extern HardwareSerial Serial;
+
+// ===== ESP =====
+class EspClass {
+	public:
+		uint32_t getFreeHeap();
+		uint32_t getMinFreeHeap();
+		uint32_t getMaxAllocHeap();
+		uint32_t getHeapSize(){ return 320 * 1024; }
+		uint32_t getCycleCount();             // 실제 경과 시간 × getCpuFreqMHz() (CPU 시간 측정용)
+		uint32_t getCpuFreqMHz(){ return 240; }
+		void restart(){ exit(0); }
+};
+extern EspClass ESP;
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
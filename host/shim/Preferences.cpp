@@ -0,0 +1,57 @@
+// =============================
+// File: host/shim/Preferences.cpp
+// =============================
+#include <Preferences.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+	std::map<std::string, std::vector<uint8_t>>& store(){
+		static std::map<std::string, std::vector<uint8_t>> s;
+		return s;
+	}
+	std::string path(const char* ns, const char* key){ return std::string(ns) + "/" + key; }
+}
+
+bool Preferences::begin(const char* name, bool readOnly){
+	if(!name || strlen(name) >= sizeof(_ns)) return false;   // NVS 네임스페이스는 15자 이하
+	strcpy(_ns, name);
+	_ro = readOnly;
+	return true;
+}
+
+size_t Preferences::putBytes(const char* key, const void* p, size_t n){
+	if(!_ns[0] || _ro || !key) return 0;
+	store()[path(_ns, key)].assign((const uint8_t*)p, (const uint8_t*)p + n);
+	return n;
+}
+
+size_t Preferences::getBytes(const char* key, void* out, size_t cap){
+	if(!_ns[0] || !key) return 0;
+	auto it = store().find(path(_ns, key));
+	if(it == store().end() || it->second.size() > cap) return 0;
+	memcpy(out, it->second.data(), it->second.size());
+	return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key){
+	if(!_ns[0] || !key) return 0;
+	auto it = store().find(path(_ns, key));
+	return it == store().end() ? 0 : it->second.size();
+}
+
+bool Preferences::isKey(const char* key){ return getBytesLength(key) > 0; }
+
+bool Preferences::remove(const char* key){
+	if(!_ns[0] || _ro || !key) return false;
+	return store().erase(path(_ns, key)) > 0;
+}
+
+bool Preferences::clear(){
+	if(!_ns[0] || _ro) return false;
+	std::string prefix = std::string(_ns) + "/";
+	for(auto it = store().begin(); it != store().end();)
+		it = it->first.compare(0, prefix.size(), prefix) == 0 ? store().erase(it) : std::next(it);
+	return true;
+}
@@ -0,0 +1,34 @@
+// =============================
+// File: host/shim/Preferences.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// NVS 심: 프로세스 안의 메모리 맵 (네임스페이스/키별 바이트열, 재시작하면 사라짐)
+class Preferences {
+	public:
+		bool begin(const char* name, bool readOnly = false);
+		void end(){ _ns[0] = '\0'; }
+
+		size_t putBytes(const char* key, const void* p, size_t n);
+		size_t getBytes(const char* key, void* out, size_t cap);
+		size_t getBytesLength(const char* key);
+		bool   isKey(const char* key);
+		bool   remove(const char* key);
+		bool   clear();
+
+		size_t   putUShort(const char* key, uint16_t v){ return putBytes(key, &v, sizeof(v)); }
+		uint16_t getUShort(const char* key, uint16_t def = 0){ return get_(key, def); }
+		size_t   putUInt(const char* key, uint32_t v){ return putBytes(key, &v, sizeof(v)); }
+		uint32_t getUInt(const char* key, uint32_t def = 0){ return get_(key, def); }
+		size_t   putFloat(const char* key, float v){ return putBytes(key, &v, sizeof(v)); }
+		float    getFloat(const char* key, float def = NAN){ return get_(key, def); }
+
+	private:
+		template <class T> T get_(const char* key, T def){
+			T v;
+			return getBytes(key, &v, sizeof(v)) == sizeof(v) ? v : def;
+		}
+		char _ns[16] = "";
+		bool _ro = false;
+};
@@ -0,0 +1,80 @@
+// =============================
+// File: host/shim/SensirionI2cSps30.cpp
+// =============================
+#include <SensirionI2cSps30.h>
+#include "../sim/HostSim.h"
+
+namespace {
+	constexpr int16_t ERR_WRITE = 0x0100;
+	constexpr int16_t ERR_READ  = 0x0200;
+	constexpr int16_t ERR_CRC   = 0x0300;
+}
+
+int16_t SensirionI2cSps30::send_(uint16_t cmd, const uint16_t* words, uint8_t n){
+	if(!_wire) return ERR_WRITE;
+	_wire->beginTransmission(_addr);
+	_wire->write((uint8_t)(cmd >> 8));
+	_wire->write((uint8_t)cmd);
+	for(uint8_t i = 0; i < n; i++){
+		uint8_t w[2] = { (uint8_t)(words[i] >> 8), (uint8_t)words[i] };
+		_wire->write(w, 2);
+		_wire->write(host::crc8(w, 2));
+	}
+	return _wire->endTransmission() == 0 ? 0 : ERR_WRITE;
+}
+
+int16_t SensirionI2cSps30::recv_(uint16_t* words, uint8_t n){
+	size_t len = (size_t)n * 3;
+	if(_wire->requestFrom(_addr, len, true) != len) return ERR_READ;
+	for(uint8_t i = 0; i < n; i++){
+		uint8_t w[3];
+		for(uint8_t k = 0; k < 3; k++) w[k] = (uint8_t)_wire->read();
+		if(host::crc8(w, 2) != w[2]) return ERR_CRC;
+		words[i] = (uint16_t)((w[0] << 8) | w[1]);
+	}
+	return 0;
+}
+
+int16_t SensirionI2cSps30::startMeasurement(SPS30OutputFormat fmt){
+	uint16_t arg = (uint16_t)fmt;
+	int16_t err = send_(CMD_START, &arg, 1);
+	delay(20);
+	return err;
+}
+
+int16_t SensirionI2cSps30::stopMeasurement(){
+	int16_t err = send_(CMD_STOP, nullptr, 0);
+	delay(20);
+	return err;
+}
+
+int16_t SensirionI2cSps30::readMeasurementValuesFloat(float& mc1p0, float& mc2p5, float& mc4p0, float& mc10p0,
+                                                      float& nc0p5, float& nc1p0, float& nc2p5, float& nc4p0, float& nc10p0,
+                                                      float& typicalParticleSize){
+	int16_t err = send_(CMD_READ, nullptr, 0);
+	if(err) return err;
+	delay(20);
+	uint16_t w[20];
+	err = recv_(w, 20);
+	if(err) return err;
+	float* out[10] = { &mc1p0, &mc2p5, &mc4p0, &mc10p0, &nc0p5, &nc1p0, &nc2p5, &nc4p0, &nc10p0, &typicalParticleSize };
+	for(uint8_t i = 0; i < 10; i++){
+		uint32_t bits = ((uint32_t)w[i * 2] << 16) | w[i * 2 + 1];
+		memcpy(out[i], &bits, 4);
+	}
+	return 0;
+}
+
+int16_t SensirionI2cSps30::sleep(){
+	int16_t err = send_(CMD_SLEEP, nullptr, 0);
+	delay(5);
+	return err;
+}
+
+// 첫 명령은 깨우기 펄스 (센서가 NACK할 수 있음), 두 번째가 실제 wake-up
+int16_t SensirionI2cSps30::wakeUpSequence(){
+	send_(CMD_WAKE, nullptr, 0);
+	int16_t err = send_(CMD_WAKE, nullptr, 0);
+	delay(5);
+	return err;
+}
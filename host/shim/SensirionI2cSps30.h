@@ -0,0 +1,37 @@
+// =============================
+// File: host/shim/SensirionI2cSps30.h
+// =============================
+#pragma once
+#include <Wire.h>
+
+// Sensirion I2C SPS30 1.x 호환 심 (명령 코드/지연/CRC는 원본 드라이버와 같음)
+enum SPS30OutputFormat {
+	SPS30_OUTPUT_FORMAT_OUTPUT_FORMAT_FLOAT = 768,
+	SPS30_OUTPUT_FORMAT_OUTPUT_FORMAT_UINT16 = 1280,
+};
+
+class SensirionI2cSps30 {
+	public:
+		static constexpr uint16_t CMD_START = 0x0010;
+		static constexpr uint16_t CMD_STOP  = 0x0104;
+		static constexpr uint16_t CMD_READ  = 0x0300;
+		static constexpr uint16_t CMD_SLEEP = 0x1001;
+		static constexpr uint16_t CMD_WAKE  = 0x1103;
+
+		void begin(TwoWire& wire, uint8_t addr){ _wire = &wire; _addr = addr; }
+
+		int16_t startMeasurement(SPS30OutputFormat fmt);
+		int16_t stopMeasurement();
+		int16_t readMeasurementValuesFloat(float& mc1p0, float& mc2p5, float& mc4p0, float& mc10p0,
+		                                   float& nc0p5, float& nc1p0, float& nc2p5, float& nc4p0, float& nc10p0,
+		                                   float& typicalParticleSize);
+		int16_t sleep();
+		int16_t wakeUpSequence();
+
+	private:
+		int16_t send_(uint16_t cmd, const uint16_t* words, uint8_t n);
+		int16_t recv_(uint16_t* words, uint8_t n);
+
+		TwoWire* _wire = nullptr;
+		uint8_t  _addr = 0x69;
+};
@@ -0,0 +1,61 @@
+// =============================
+// File: host/shim/Wire.cpp
+// =============================
+#include <Wire.h>
+#include "../sim/HostSim.h"
+
+TwoWire Wire(0);
+
+bool TwoWire::begin(int, int, uint32_t frequency){
+	if(frequency) _hz = frequency;
+	return true;
+}
+
+void TwoWire::busTime_(size_t bytes){
+	host::counters().i2c_xfers++;
+	host::addBusUs(((uint64_t)bytes * 9 * 1000000 + _hz - 1) / _hz);
+}
+
+void TwoWire::beginTransmission(uint8_t addr){
+	_addr = addr;
+	_tx_len = 0;
+	_tx_ovf = false;
+}
+
+size_t TwoWire::write(uint8_t c){
+	if(_tx_len >= BUFFER_LENGTH){ _tx_ovf = true; return 0; }
+	_tx[_tx_len++] = c;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t* p, size_t n){
+	size_t w = 0;
+	while(w < n && write(p[w])) w++;
+	return w;
+}
+
+// 0: 성공, 1: 버퍼 초과, 2: 주소 NACK, 3: 데이터 NACK (Arduino 규약)
+uint8_t TwoWire::endTransmission(bool sendStop){
+	busTime_(1 + _tx_len);
+	if(_tx_ovf) return 1;
+	host::I2CDevice* dev = host::i2cDevice(_addr);
+	if(!dev){ host::counters().i2c_nacks++; return 2; }
+	if(_tx_len && !dev->write(_tx, _tx_len)){ host::counters().i2c_nacks++; return 3; }
+	if(sendStop) dev->stop();
+	return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t len, uint8_t sendStop){
+	_rx_len = _rx_pos = 0;
+	if(len > BUFFER_LENGTH) len = BUFFER_LENGTH;
+	host::I2CDevice* dev = host::i2cDevice(addr);
+	if(!dev){
+		busTime_(1);
+		host::counters().i2c_nacks++;
+		return 0;
+	}
+	_rx_len = dev->read(_rx, len);
+	busTime_(1 + _rx_len);
+	if(sendStop) dev->stop();
+	return (uint8_t)_rx_len;
+}
@@ -0,0 +1,50 @@
+// =============================
+// File: host/shim/Wire.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// I2C 마스터 심: 주소별로 등록된 host::I2CDevice(host/sim/HostSim.h)에 트랜잭션을 전달합니다.
+// 전송 바이트마다 9비트 / 현재 클럭만큼 가상 시각을 진행시킵니다. (START/주소 바이트 포함)
+// 버퍼 크기는 ESP32 Arduino 코어와 같은 128바이트입니다.
+class TwoWire : public Stream {
+	public:
+		static constexpr size_t BUFFER_LENGTH = 128;
+
+		explicit TwoWire(uint8_t bus_num = 0): _bus(bus_num) {}
+		bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+		bool end(){ return true; }
+		bool setClock(uint32_t hz){ if(hz) _hz = hz; return true; }
+		uint32_t getClock(){ return _hz; }
+
+		void beginTransmission(uint8_t addr);
+		void beginTransmission(int addr){ beginTransmission((uint8_t)addr); }
+		uint8_t endTransmission(bool sendStop = true);
+
+		uint8_t requestFrom(uint8_t addr, uint8_t len, uint8_t sendStop);
+		uint8_t requestFrom(uint8_t addr, uint8_t len){ return requestFrom(addr, len, (uint8_t)1); }
+		uint8_t requestFrom(int addr, int len){ return requestFrom((uint8_t)addr, (uint8_t)len, (uint8_t)1); }
+		uint8_t requestFrom(int addr, int len, int sendStop){ return requestFrom((uint8_t)addr, (uint8_t)len, (uint8_t)sendStop); }
+		size_t  requestFrom(uint8_t addr, size_t len, bool sendStop){ return requestFrom(addr, (uint8_t)len, (uint8_t)sendStop); }
+
+		size_t write(uint8_t c) override;
+		size_t write(const uint8_t* p, size_t n) override;
+		using Print::write;
+		int available() override { return (int)(_rx_len - _rx_pos); }
+		int read() override { return _rx_pos < _rx_len ? _rx[_rx_pos++] : -1; }
+		int peek() override { return _rx_pos < _rx_len ? _rx[_rx_pos] : -1; }
+		void flush() override {}
+
+	private:
+		void busTime_(size_t bytes);
+
+		uint8_t  _bus;
+		uint32_t _hz = 100000;
+		uint8_t  _addr = 0;
+		uint8_t  _tx[BUFFER_LENGTH];
+		size_t   _tx_len = 0;
+		bool     _tx_ovf = false;
+		uint8_t  _rx[BUFFER_LENGTH];
+		size_t   _rx_len = 0, _rx_pos = 0;
+};
+extern TwoWire Wire;
@@ -0,0 +1,18 @@
+// =============================
+// File: host/shim/esp_heap_caps.cpp
+// =============================
+#include <esp_heap_caps.h>
+#include <string.h>
+#include "../sim/HostSim.h"
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t){
+	memset(info, 0, sizeof(*info));
+	host::Allocs a = host::allocsTotal();
+	info->allocated_blocks = (size_t)(a.n - a.frees);
+	info->total_allocated_bytes = (size_t)a.bytes;
+	info->total_free_bytes = heap_caps_get_free_size(0);
+	info->largest_free_block = heap_caps_get_largest_free_block(0);
+}
+
+size_t heap_caps_get_free_size(uint32_t){ return 200 * 1024; }
+size_t heap_caps_get_largest_free_block(uint32_t){ return 110 * 1024; }
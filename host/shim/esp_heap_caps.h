@@ -0,0 +1,25 @@
+// =============================
+// File: host/shim/esp_heap_caps.h
+// =============================
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// heap_caps_get_info 심: 프로세스 전체 malloc 계수(host::allocsTotal())를 돌려줍니다.
+// allocated_blocks = 할당 - 해제 횟수, total_allocated_bytes = 요청 바이트 누적 (해제 크기는 추적하지 않음)
+#define MALLOC_CAP_8BIT    (1 << 2)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+typedef struct {
+	size_t total_free_bytes;
+	size_t total_allocated_bytes;
+	size_t largest_free_block;
+	size_t minimum_free_bytes;
+	size_t allocated_blocks;
+	size_t free_blocks;
+	size_t total_blocks;
+} multi_heap_info_t;
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
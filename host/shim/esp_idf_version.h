@@ -0,0 +1,9 @@
+// =============================
+// File: host/shim/esp_idf_version.h
+// =============================
+#pragma once
+
+// 호스트 빌드는 IDF 없이 컴파일하므로 버전은 자리표시값 (CONFIG_PM_ENABLE이 없어 분기에 쓰이지 않음)
+#define ESP_IDF_VERSION_MAJOR 5
+#define ESP_IDF_VERSION_MINOR 0
+#define ESP_IDF_VERSION_PATCH 0
@@ -0,0 +1,7 @@
+// =============================
+// File: host/shim/esp_pm.h
+// =============================
+#pragma once
+
+// esp_pm 심: CONFIG_PM_ENABLE을 정의하지 않으므로 power::begin(LOW_POWER)은 false (DFS/light sleep 없음)
+// power::awakeBegin/End/takeAwakeMs는 micros() 가상 시계로 동작합니다.
@@ -0,0 +1,243 @@
+// =============================
+// File: host/shim/freertos/FreeRTOS.cpp
+// =============================
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "queue.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "../../sim/HostSim.h"
+
+struct HostTask {
+	uint32_t       notify;
+	const char*    name;
+	UBaseType_t    prio;
+	TaskFunction_t fn;
+	void*          arg;
+	ucontext_t     ctx;
+	uint64_t       wake_us;    // 대기 만료 시각 (FOREVER = 무기한)
+	const void*    wait_on;    // 깨울 수 있는 객체 (알림 = Task 자신, 뮤텍스 = HostSem)
+	bool           ready;      // 알림/뮤텍스 반환으로 깨어남
+	bool           dead;
+	uint32_t       runs;
+	host::Account  acc;
+};
+struct HostSem  { bool recursive; uint32_t depth; HostTask* owner; };
+struct HostQueue {
+	UBaseType_t len, size, head, count;
+	uint8_t* buf;
+};
+
+namespace {
+	constexpr uint8_t  TASK_MAX = 8;
+	constexpr size_t   TASK_STACK = 256 * 1024;   // 호스트 libc(printf 등) 기준. 보드 스택 크기와 무관
+	constexpr uint64_t FOREVER = UINT64_MAX;
+
+	HostTask  s_main = { 0, "main", 1 };
+	HostTask* s_tasks[TASK_MAX + 1] = { &s_main };
+	uint8_t   s_ntasks = 1;
+	HostTask* s_cur = &s_main;
+
+	uint64_t deadline_(TickType_t wait){
+		return wait == portMAX_DELAY ? FOREVER : host::nowUs() + (uint64_t)wait * 1000;
+	}
+
+	void switchTo_(HostTask* t){
+		t->runs++;
+		if(t == s_cur) return;
+		HostTask* prev = s_cur;
+		s_cur = t;
+		host::setAccount(t == &s_main ? nullptr : &t->acc);
+		swapcontext(&prev->ctx, &t->ctx);
+	}
+
+	// 현재 Task를 until_us까지(또는 wait_on 객체가 깨울 때까지) 재우고, 그동안 다른 Task를 실행
+	// - 지금 실행할 수 있는 Task 중 우선순위가 가장 높은 것, 없으면 가장 먼저 깨어날 Task로 시계를 넘김
+	// - 깨울 Task가 하나도 없으면(모두 무기한 대기) 교착 대신 false로 복귀
+	bool block_(uint64_t until_us, const void* on){
+		HostTask* me = s_cur;
+		me->wake_us = until_us; me->wait_on = on; me->ready = false;
+
+		const uint64_t now = host::nowUs();
+		HostTask* run = nullptr;
+		HostTask* next = nullptr;
+		for(uint8_t i = 0; i < s_ntasks; i++){
+			HostTask* t = s_tasks[i];
+			if(t->dead) continue;
+			if(t->ready || t->wake_us <= now){
+				if(!run || t->prio > run->prio) run = t;
+			} else if(!next || t->wake_us < next->wake_us){
+				next = t;
+			}
+		}
+		bool ok = true;
+		if(!run){
+			if(next && next->wake_us != FOREVER){
+				host::idleUntilUs(next->wake_us);
+				run = next;
+			} else {
+				run = me->dead ? &s_main : me;
+				ok = false;
+			}
+		}
+		run->wake_us = FOREVER; run->wait_on = nullptr; run->ready = false;
+		switchTo_(run);
+		return ok;
+	}
+
+	void wake_(const void* on){
+		for(uint8_t i = 0; i < s_ntasks; i++)
+			if(s_tasks[i]->wait_on == on) s_tasks[i]->ready = true;
+	}
+
+	void blockHook_(uint64_t until_us){
+		while(host::nowUs() < until_us && block_(until_us, nullptr)){}
+		host::idleUntilUs(until_us);
+	}
+
+	void taskEntry_(){
+		HostTask* t = s_cur;
+		t->fn(t->arg);
+		vTaskDelete(nullptr);   // 보드와 달리 반환해도 되지만 같은 정리 경로를 씀
+	}
+}
+
+namespace host {
+	uint8_t taskInfo(TaskInfo* out, uint8_t max){
+		uint8_t n = 0;
+		for(uint8_t i = 1; i < s_ntasks && n < max; i++, n++){
+			out[n].name = s_tasks[i]->name;
+			out[n].runs = s_tasks[i]->runs;
+			out[n].acc = &s_tasks[i]->acc;
+		}
+		return n;
+	}
+}
+
+// ===== Task =====
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t, void* arg, UBaseType_t prio, TaskHandle_t* out, BaseType_t){
+	if(out) *out = nullptr;
+	if(!fn || s_ntasks > TASK_MAX) return pdFAIL;
+	HostTask* t = (HostTask*)calloc(1, sizeof(HostTask));
+	void* stack = malloc(TASK_STACK);
+	if(!t || !stack){ free(t); free(stack); return pdFAIL; }
+	t->name = name; t->prio = prio; t->fn = fn; t->arg = arg;
+	t->wake_us = host::nowUs();   // 만든 Task가 다음 차단 대기 때 처음 실행됨
+	getcontext(&t->ctx);
+	t->ctx.uc_stack.ss_sp = stack;
+	t->ctx.uc_stack.ss_size = TASK_STACK;
+	t->ctx.uc_link = nullptr;
+	makecontext(&t->ctx, taskEntry_, 0);
+	s_tasks[s_ntasks++] = t;
+	host::setBlockHook(blockHook_);
+	if(out) *out = t;
+	return pdPASS;
+}
+
+// 스택은 삭제되는 Task 자신이 쓰고 있을 수 있으므로 해제하지 않음 (호스트 프로세스 수명 동안 유지)
+void vTaskDelete(TaskHandle_t h){
+	HostTask* t = h ? h : s_cur;
+	if(t == &s_main) return;
+	t->dead = true;
+	if(t == s_cur) block_(FOREVER, nullptr);
+}
+
+void vTaskDelay(TickType_t ticks){ host::blockUs((uint64_t)ticks * 1000); }
+TickType_t xTaskGetTickCount(){ return (TickType_t)(host::nowUs() / 1000); }
+TaskHandle_t xTaskGetCurrentTaskHandle(){ return s_cur; }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t){ return 0; }
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait){
+	HostTask* me = s_cur;
+	const uint64_t until = deadline_(wait);
+	while(!me->notify && host::nowUs() < until){
+		if(!block_(until, me)){
+			if(until != FOREVER) host::idleUntilUs(until);
+			break;
+		}
+	}
+	uint32_t n = me->notify;
+	if(n) me->notify = clear ? 0 : n - 1;
+	return n;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t h){
+	if(!h) return pdPASS;
+	h->notify++;
+	if(h->wait_on == h) h->ready = true;
+	return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t h, BaseType_t* woken){
+	xTaskNotifyGive(h);
+	if(woken) *woken = pdFALSE;
+}
+
+// ===== Semaphore =====
+static SemaphoreHandle_t semCreate_(bool recursive){
+	HostSem* s = (HostSem*)malloc(sizeof(HostSem));
+	if(s){ s->recursive = recursive; s->depth = 0; s->owner = nullptr; }
+	return s;
+}
+
+static BaseType_t semTake_(SemaphoreHandle_t s, TickType_t wait, bool recursive){
+	if(!s || s->recursive != recursive) return pdFALSE;
+	const uint64_t until = deadline_(wait);
+	for(;;){
+		if(!s->depth || (recursive && s->owner == s_cur)){
+			s->depth++;
+			s->owner = s_cur;
+			return pdTRUE;
+		}
+		if(s->owner == s_cur) return pdFALSE;   // 비재귀 뮤텍스 재점유 = 교착
+		if(host::nowUs() >= until || !block_(until, s)) return pdFALSE;
+	}
+}
+
+static BaseType_t semGive_(SemaphoreHandle_t s, bool recursive){
+	if(!s || s->recursive != recursive || !s->depth || s->owner != s_cur) return pdFALSE;
+	if(--s->depth == 0){
+		s->owner = nullptr;
+		wake_(s);
+	}
+	return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(){ return semCreate_(false); }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(){ return semCreate_(true); }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait){ return semTake_(s, wait, false); }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s){ return semGive_(s, false); }
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait){ return semTake_(s, wait, true); }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s){ return semGive_(s, true); }
+
+// ===== Queue =====
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t size){
+	if(!len || !size) return nullptr;
+	HostQueue* q = (HostQueue*)malloc(sizeof(HostQueue));
+	if(!q) return nullptr;
+	q->buf = (uint8_t*)malloc((size_t)len * size);
+	if(!q->buf){ free(q); return nullptr; }
+	q->len = len; q->size = size; q->head = 0; q->count = 0;
+	return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t){
+	if(!q || q->count >= q->len) return pdFALSE;
+	UBaseType_t tail = (q->head + q->count) % q->len;
+	memcpy(q->buf + (size_t)tail * q->size, item, q->size);
+	q->count++;
+	return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void* out, TickType_t){
+	if(!q || !q->count) return pdFALSE;
+	memcpy(out, q->buf + (size_t)q->head * q->size, q->size);
+	q->head = (q->head + 1) % q->len;
+	q->count--;
+	return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q){ return q ? q->count : 0; }
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q){ return q ? q->len - q->count : 0; }
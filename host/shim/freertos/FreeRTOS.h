@@ -0,0 +1,30 @@
+// =============================
+// File: host/shim/freertos/FreeRTOS.h
+// =============================
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// 호스트 빌드용 FreeRTOS 심 (한 OS 스레드 안의 협력형 Task)
+// - 틱 = 1ms, 대기는 가상 시계를 진행시킵니다. (host/sim/HostSim.h)
+// - Task는 차단 대기에서만 전환되므로 크리티컬 섹션은 아무 일도 하지 않습니다.
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdFALSE  0
+#define pdTRUE   1
+#define pdFAIL   0
+#define pdPASS   1
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define configMAX_PRIORITIES 25
+
+typedef struct { uint32_t owner; uint32_t count; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0, 0 }
+#define portENTER_CRITICAL(mux)     ((void)(mux))
+#define portEXIT_CRITICAL(mux)      ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)  ((void)(mux))
+#define portYIELD_FROM_ISR(...)     ((void)0)
@@ -0,0 +1,14 @@
+// =============================
+// File: host/shim/freertos/queue.h
+// =============================
+#pragma once
+#include "FreeRTOS.h"
+
+// 고정 크기 원형 큐 (생성 시 1회 할당). 가득 찼거나 비었으면 대기 없이 실패
+typedef struct HostQueue* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t q, void* out, TickType_t wait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q);
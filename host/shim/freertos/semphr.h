@@ -0,0 +1,16 @@
+// =============================
+// File: host/shim/freertos/semphr.h
+// =============================
+#pragma once
+#include "FreeRTOS.h"
+
+// 뮤텍스: 다른 Task가 점유 중이면 반환되거나 wait가 지날 때까지 대기합니다.
+// 점유 Task가 (비재귀) 뮤텍스를 다시 잡으면 교착이므로 pdFALSE
+typedef struct HostSem* SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s);
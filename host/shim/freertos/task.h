@@ -0,0 +1,25 @@
+// =============================
+// File: host/shim/freertos/task.h
+// =============================
+#pragma once
+#include "FreeRTOS.h"
+
+// 협력형 Task: ucontext 스택 위에서 돌고, delay/vTaskDelay/알림 대기/뮤텍스 대기에서만 다른 Task로 넘어갑니다.
+// - 대기 중 실행 순서: 지금 깨어날 수 있는 Task 중 우선순위가 높은 것 → 없으면 가장 먼저 깨어날 시각으로 시계를 넘김
+// - 선점은 없습니다. 알림을 받은 Task는 보내는 쪽이 다음에 대기할 때 실행됩니다.
+// - 호스트 메인 스레드가 우선순위 1의 "main" Task입니다. 만든 Task는 다음 대기 때 처음 실행됩니다.
+typedef struct HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                                   UBaseType_t prio, TaskHandle_t* out, BaseType_t core);
+void vTaskDelete(TaskHandle_t h);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t h);
+
+// 알림이 없으면 알림 또는 wait 틱까지 대기 후 0 반환
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t h);
+void vTaskNotifyGiveFromISR(TaskHandle_t h, BaseType_t* woken);
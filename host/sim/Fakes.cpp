@@ -0,0 +1,326 @@
+// =============================
+// File: host/sim/Fakes.cpp
+// =============================
+#include "Fakes.h"
+#include <math.h>
+#include <string.h>
+
+namespace host {
+
+namespace {
+	inline uint16_t be16(const uint8_t* p){ return (uint16_t)((p[0] << 8) | p[1]); }
+
+	// Sensirion 워드 (2바이트 + CRC) 인수 n개를 검사하며 꺼냄
+	bool sensirionArgs(const uint8_t* p, size_t len, uint16_t* out, uint8_t n){
+		if(len != (size_t)n * 3) return false;
+		for(uint8_t i = 0; i < n; i++){
+			if(crc8(p + i * 3, 2) != p[i * 3 + 2]) return false;
+			out[i] = be16(p + i * 3);
+		}
+		return true;
+	}
+
+	void sensirionWord(uint8_t* out, uint16_t w){
+		out[0] = (uint8_t)(w >> 8);
+		out[1] = (uint8_t)w;
+		out[2] = crc8(out, 2);
+	}
+}
+
+// ===== ADPD188BI =====
+bool Adpd188Fake::write(const uint8_t* p, size_t n){
+	tick_();
+	_ptr = p[0] & 0x7F;
+	if(n < 3) return true;
+	uint16_t v = be16(p + 1);
+	switch(_ptr){
+		case 0x0F:                                   // SW_RESET
+			if(v & 1){ memset(_regs, 0, sizeof(_regs)); _normal = false; _fifo_n = 0; }
+			return true;
+		case 0x10:                                   // MODE: 1=PROGRAM, 2=NORMAL
+			if((v & 3) == 2){
+				if(!_normal) _next_us = nowUs() + sample_us;
+				_normal = true;
+			} else {
+				_normal = false;
+				_fifo_n = 0;                         // PROGRAM 진입 시 FIFO 비움
+			}
+			break;
+		case 0x57:                                   // EFUSE_CTRL → 상태 0x67 = 0x04 (refresh 완료)
+			_regs[0x67] = (v == 0x0007) ? 0x0004 : 0x0000;
+			break;
+		default: break;
+	}
+	_regs[_ptr] = v;
+	return true;
+}
+
+size_t Adpd188Fake::read(uint8_t* p, size_t n){
+	tick_();
+	if(_ptr == 0x60){                                // FIFO 데이터 (읽은 만큼 빠짐, 비면 0)
+		size_t k = n < _fifo_n ? n : _fifo_n;
+		memcpy(p, _fifo, k);
+		memmove(_fifo, _fifo + k, _fifo_n - k);
+		_fifo_n -= k;
+		if(k < n) memset(p + k, 0, n - k);
+		return n;
+	}
+	uint16_t v = reg_(_ptr);
+	for(size_t i = 0; i < n; i++) p[i] = (i & 1) ? (uint8_t)v : (uint8_t)(v >> 8);
+	return n;
+}
+
+uint16_t Adpd188Fake::reg_(uint8_t r){
+	switch(r){
+		case 0x00: return (uint16_t)((_fifo_n << 8) | (_regs[0] & 0xFF));
+		case 0x08: return 0x0A16;                    // DEVID
+		// eFuse (AN-2033): 모듈 30, 이득/오프셋 코드는 보정 계수가 1에 가깝도록
+		case 0x70: return 30;
+		case 0x71: return 112;
+		case 0x72: return 112;
+		case 0x73: return 206;
+		case 0x74: return 154;
+		default:   return _regs[r & 0x7F];
+	}
+}
+
+void Adpd188Fake::tick_(){
+	if(!_normal) return;
+	uint64_t now = nowUs();
+	while(now >= _next_us){
+		uint32_t a = (uint32_t)lroundf((float)blue * (1.0f + _rng.next(noise)));
+		uint32_t b = (uint32_t)lroundf((float)ir * (1.0f + _rng.next(noise)));
+		push_(a, b);
+		_next_us += sample_us;
+	}
+}
+
+void Adpd188Fake::push_(uint32_t a, uint32_t b){
+	if(_fifo_n + 8 > sizeof(_fifo)){ overflows++; return; }
+	const uint16_t w[4] = { (uint16_t)a, (uint16_t)(a >> 16), (uint16_t)b, (uint16_t)(b >> 16) };
+	for(uint8_t k = 0; k < 4; k++){
+		_fifo[_fifo_n++] = (uint8_t)(w[k] >> 8);
+		_fifo[_fifo_n++] = (uint8_t)w[k];
+	}
+}
+
+// ===== ADS1115 =====
+bool Ads1115Fake::write(const uint8_t* p, size_t n){
+	tick_();
+	_ptr = p[0] & 0x03;
+	if(n < 3) return true;
+	uint16_t v = be16(p + 1);
+	switch(_ptr){
+		case 0x01:
+			_config = v;
+			if(!(v & 0x0100) || (v & 0x8000)){        // 연속 모드 또는 단발 시작 (OS=1)
+				_busy = true;
+				_done_us = nowUs() + convUs_();
+			}
+			break;
+		case 0x02: _lo = v; break;
+		case 0x03: _hi = v; break;
+		default: break;
+	}
+	return true;
+}
+
+size_t Ads1115Fake::read(uint8_t* p, size_t n){
+	tick_();
+	uint16_t v;
+	switch(_ptr){
+		case 0x00: v = (uint16_t)_conv; break;
+		case 0x01: {
+			bool single = _config & 0x0100;
+			bool idle = single ? !_busy : false;     // 연속 모드에서는 항상 변환 중
+			v = (uint16_t)((_config & 0x7FFF) | (idle ? 0x8000 : 0));
+			break;
+		}
+		case 0x02: v = _lo; break;
+		default:   v = _hi; break;
+	}
+	for(size_t i = 0; i < n; i++) p[i] = (i & 1) ? (uint8_t)v : (uint8_t)(v >> 8);
+	return n;
+}
+
+uint32_t Ads1115Fake::convUs_() const {
+	static const uint16_t sps[8] = { 8, 16, 32, 64, 128, 250, 475, 860 };
+	return 1000000u / sps[(_config >> 5) & 7];
+}
+
+int16_t Ads1115Fake::convert_() const {
+	static const float fsr[8] = { 6.144f, 4.096f, 2.048f, 1.024f, 0.512f, 0.256f, 0.256f, 0.256f };
+	uint8_t mux = (_config >> 12) & 7;
+	if(mux < 4) return 0;                            // 차동 입력은 모델링하지 않음
+	float v = volts[mux - 4] + _rng.next(noise_v);
+	long raw = lroundf(v / fsr[(_config >> 9) & 7] * 32768.0f);
+	if(raw > 32767) raw = 32767;
+	if(raw < -32768) raw = -32768;
+	return (int16_t)raw;
+}
+
+void Ads1115Fake::tick_(){
+	if(!_busy) return;
+	uint64_t now = nowUs();
+	if(now < _done_us) return;
+	if(_config & 0x0100){                            // 단발: 1회 후 파워다운
+		_conv = convert_();
+		conversions++;
+		_busy = false;
+		return;
+	}
+	uint32_t conv = convUs_();
+	uint64_t k = (now - _done_us) / conv + 1;        // 그동안 끝난 연속 변환 수 (마지막 값만 남음)
+	_conv = convert_();
+	conversions += (uint32_t)k;
+	_done_us += k * conv;
+}
+
+// ===== SPS30 =====
+bool Sps30Fake::write(const uint8_t* p, size_t n){
+	if(n < 2) return false;
+	uint16_t cmd = be16(p);
+	if(asleep){
+		if(cmd != 0x1103) return false;
+		if(!_woken){ _woken = true; return false; }  // 첫 명령은 인터페이스만 깨움 (NACK)
+		asleep = false; _woken = false;
+		return true;
+	}
+	uint16_t arg;
+	switch(cmd){
+		case 0x0010:                                 // start: 상위 바이트 = 출력 포맷 (0x03 float), 하위 바이트는 더미
+			if(!sensirionArgs(p + 2, n - 2, &arg, 1) || (arg >> 8) != 0x03) return false;
+			measuring = true;
+			return true;
+		case 0x0104: measuring = false; return true;
+		case 0x0300: {
+			_resp_n = 0;
+			if(!measuring) return true;              // 읽을 데이터 없음 → 읽기 0바이트
+			float v[10] = { mc[0], mc[1], mc[2], mc[3], nc[0], nc[1], nc[2], nc[3], nc[4], typical };
+			for(uint8_t i = 0; i < 10; i++){
+				uint32_t bits; memcpy(&bits, &v[i], 4);
+				sensirionWord(_resp + i * 6, (uint16_t)(bits >> 16));
+				sensirionWord(_resp + i * 6 + 3, (uint16_t)bits);
+			}
+			_resp_n = sizeof(_resp);
+			return true;
+		}
+		case 0x1001:                                 // sleep (idle 상태에서만)
+			if(measuring) return false;
+			asleep = true;
+			return true;
+		case 0x1103: return true;
+		default: return false;
+	}
+}
+
+size_t Sps30Fake::read(uint8_t* p, size_t n){
+	size_t k = n < _resp_n ? n : _resp_n;
+	memcpy(p, _resp, k);
+	_resp_n = 0;
+	return k;
+}
+
+// ===== BME688 =====
+void Bme688Fake::reset_(){
+	memset(_regs, 0, sizeof(_regs));
+	_regs[0xD0] = 0x61;
+}
+
+// 쓰기는 (레지스터, 값) 쌍의 나열. 바이트 1개면 읽기 포인터만 설정
+bool Bme688Fake::write(const uint8_t* p, size_t n){
+	if(!_regs[0xD0]) reset_();
+	_ptr = p[0];
+	for(size_t i = 0; i + 1 < n; i += 2){
+		uint8_t reg = p[i], val = p[i + 1];
+		if(reg == 0xE0){ if(val == 0xB6) reset_(); continue; }
+		_regs[reg] = val;
+		if(reg == 0x74 && (val & 0x03) == 0x01){
+			trigger_();
+			_regs[0x74] &= (uint8_t)~0x03;           // 측정 후 sleep 모드로 복귀
+		}
+	}
+	return true;
+}
+
+size_t Bme688Fake::read(uint8_t* p, size_t n){
+	if(!_regs[0xD0]) reset_();
+	for(size_t i = 0; i < n; i++) p[i] = _regs[(uint8_t)(_ptr + i)];
+	return n;
+}
+
+void Bme688Fake::trigger_(){
+	measurements++;
+	uint8_t* f = _regs + 0x1D;
+	int16_t  t = (int16_t)lroundf(temp_c * 100.0f);
+	uint16_t h = (uint16_t)lroundf(rh * 100.0f);
+	uint32_t g = 0;
+	bool gas = _regs[0x71] & 0x10;
+	if(gas){
+		uint32_t heat_c = (uint32_t)_regs[0x5A] * 2;
+		g = heat_c ? (uint32_t)((uint64_t)gas_ohm * 320 / heat_c) : gas_ohm;
+	}
+	f[0] = 0x80;
+	f[1] = (uint8_t)((uint16_t)t >> 8); f[2] = (uint8_t)t;
+	f[3] = (uint8_t)(h >> 8); f[4] = (uint8_t)h;
+	f[5] = (uint8_t)(press_pa >> 24); f[6] = (uint8_t)(press_pa >> 16); f[7] = (uint8_t)(press_pa >> 8); f[8] = (uint8_t)press_pa;
+	f[9] = (uint8_t)(g >> 24); f[10] = (uint8_t)(g >> 16); f[11] = (uint8_t)(g >> 8); f[12] = (uint8_t)g;
+	f[13] = gas ? 0x30 : 0x00;
+	f[14] = 0;
+}
+
+// ===== SGP30 =====
+void Sgp30Fake::respond_(const uint16_t* w, uint8_t n){
+	for(uint8_t i = 0; i < n; i++) sensirionWord(_resp + i * 3, w[i]);
+	_resp_n = (size_t)n * 3;
+}
+
+bool Sgp30Fake::write(const uint8_t* p, size_t n){
+	if(n < 2) return false;
+	uint16_t cmd = be16(p);
+	uint16_t a[2];
+	_resp_n = 0;
+	switch(cmd){
+		case 0x3682: { const uint16_t s[3] = { 0x0000, 0x0123, 0x4567 }; respond_(s, 3); return true; }
+		case 0x202F: { const uint16_t f = 0x0020; respond_(&f, 1); return true; }
+		case 0x2003: _inited = true; _init_us = nowUs(); return true;
+		case 0x2008: {
+			measures++;
+			bool warm = _inited && nowUs() - _init_us >= 15000000ull;
+			const uint16_t r[2] = { warm ? eco2 : (uint16_t)400, warm ? tvoc : (uint16_t)0 };
+			respond_(r, 2);
+			return true;
+		}
+		case 0x2015: { const uint16_t r[2] = { base_eco2, base_tvoc }; respond_(r, 2); return true; }
+		case 0x201E:                                 // TVOC 기준선이 먼저
+			if(!sensirionArgs(p + 2, n - 2, a, 2)) return false;
+			base_tvoc = a[0]; base_eco2 = a[1];
+			return true;
+		case 0x2061:
+			if(!sensirionArgs(p + 2, n - 2, a, 1)) return false;
+			humidity = a[0];
+			return true;
+		default: return false;
+	}
+}
+
+size_t Sgp30Fake::read(uint8_t* p, size_t n){
+	size_t k = n < _resp_n ? n : _resp_n;
+	memcpy(p, _resp, k);
+	_resp_n = 0;
+	return k;
+}
+
+// ===== ZE07 =====
+void ze07Frame(uint8_t out[9], float ppm){
+	uint16_t conc = (uint16_t)lroundf(ppm * 10.0f);
+	const uint16_t full = 5000;
+	out[0] = 0xFF; out[1] = 0x04; out[2] = 0x03; out[3] = 0x01;
+	out[4] = (uint8_t)(conc >> 8); out[5] = (uint8_t)conc;
+	out[6] = (uint8_t)(full >> 8); out[7] = (uint8_t)full;
+	uint8_t s = 0;
+	for(int i = 1; i <= 7; i++) s += out[i];
+	out[8] = (uint8_t)(~s + 1);
+}
+
+} // namespace host
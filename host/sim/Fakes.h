@@ -0,0 +1,149 @@
+// =============================
+// File: host/sim/Fakes.h
+// =============================
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "HostSim.h"
+
+// 스크립트로 값을 바꿀 수 있는 가짜 센서 (레지스터/명령 수준)
+// 값은 벤치/테스트가 필드에 직접 쓰고, 드라이버는 실제 칩과 같은 순서로 레지스터를 읽고 씁니다.
+// 변환/샘플 시각은 가상 시계(host::nowUs())를 따릅니다.
+namespace host {
+
+	// 재현 가능한 잡음 (xorshift32). amp × [-1, 1]
+	class Noise {
+		public:
+			explicit Noise(uint32_t seed = 0x2545F491u): _s(seed ? seed : 1) {}
+			float next(float amp){
+				_s ^= _s << 13; _s ^= _s >> 17; _s ^= _s << 5;
+				return amp * ((float)(_s & 0xFFFF) / 32767.5f - 1.0f);
+			}
+		private:
+			uint32_t _s;
+	};
+
+	// ===== ADPD188BI (SMOKE2, 0x64) =====
+	// NORMAL 모드에서 16Hz로 FIFO에 패킷(Slot A=blue, Slot B=IR 32비트 합)을 쌓습니다.
+	// 패킷 워드 순서는 실제 칩과 같은 BA (하위 워드 먼저). FIFO 128바이트가 차면 새 샘플은 버림.
+	class Adpd188Fake : public I2CDevice {
+		public:
+			uint32_t blue = 400000;         // Slot A 합계 (잡음 전)
+			uint32_t ir = 2000000;          // Slot B 합계
+			float    noise = 0.0005f;       // 상대 잡음 진폭
+			uint32_t sample_us = 62500;     // 16Hz
+			uint32_t overflows = 0;         // FIFO가 차서 버린 샘플 수
+
+			bool write(const uint8_t* p, size_t n) override;
+			size_t read(uint8_t* p, size_t n) override;
+
+		private:
+			void tick_();
+			void push_(uint32_t a, uint32_t b);
+			uint16_t reg_(uint8_t r);
+
+			uint16_t _regs[128] = {};
+			uint8_t  _ptr = 0;
+			bool     _normal = false;
+			uint64_t _next_us = 0;
+			uint8_t  _fifo[128];
+			size_t   _fifo_n = 0;
+			Noise    _rng{0x5A0E2u};
+	};
+
+	// ===== ADS1115 (0x48) =====
+	// 단발/연속 변환을 데이터레이트에 맞춘 시간으로 모델링합니다. (OS 비트, 변환 레지스터 갱신 시각)
+	// 입력: volts[ch] (AINx-GND, 단일 종단만)
+	class Ads1115Fake : public I2CDevice {
+		public:
+			float volts[4] = { 0, 0, 0, 0 };
+			float noise_v = 0.0005f;
+			uint32_t conversions = 0;       // 끝난 변환 수 (버려진 것 포함)
+
+			bool write(const uint8_t* p, size_t n) override;
+			size_t read(uint8_t* p, size_t n) override;
+
+		private:
+			void tick_();
+			int16_t convert_() const;
+			uint32_t convUs_() const;
+
+			uint16_t _config = 0x8583;      // 전원 기본값 (단발, 파워다운)
+			uint16_t _lo = 0x8000, _hi = 0x7FFF;
+			int16_t  _conv = 0;
+			uint8_t  _ptr = 0;
+			bool     _busy = false;
+			uint64_t _done_us = 0;
+			mutable Noise _rng{0xADC5u};
+	};
+
+	// ===== SPS30 (0x69) =====
+	// 측정 중이면 읽기 명령마다 mc[]/nc[]/typical을 float 빅엔디안 + 워드별 CRC로 돌려줍니다.
+	// 슬립 중에는 wake-up 명령 외에는 NACK
+	class Sps30Fake : public I2CDevice {
+		public:
+			float mc[4] = { 3.0f, 5.0f, 6.0f, 7.0f };          // PM1.0/2.5/4.0/10 (ug/m3)
+			float nc[5] = { 20.0f, 25.0f, 26.0f, 26.5f, 27.0f };
+			float typical = 0.6f;
+			bool  measuring = false;
+			bool  asleep = false;
+
+			bool write(const uint8_t* p, size_t n) override;
+			size_t read(uint8_t* p, size_t n) override;
+
+		private:
+			uint8_t _resp[60];
+			size_t  _resp_n = 0;
+			bool    _woken = false;
+	};
+
+	// ===== BME688 (0x76) =====
+	// forced 모드 트리거 시 결과 블록(0x1D부터 15바이트)을 단순화한 인코딩으로 채웁니다.
+	//   [0] status (0x80 new_data) [1..2] 온도 int16 (0.01°C) [3..4] 습도 uint16 (0.01%)
+	//   [5..8] 기압 uint32 (Pa) [9..12] 가스 저항 uint32 (Ω) [13] 0x30 gas_valid|heat_stab (가스 측정 시)
+	// 가스 저항은 히터 온도에 반비례하도록 gas_ohm × 320 / 히터 온도로 만듭니다. (프로파일 스캔용)
+	class Bme688Fake : public I2CDevice {
+		public:
+			float    temp_c = 23.5f;
+			float    rh = 41.0f;
+			uint32_t press_pa = 101325;
+			uint32_t gas_ohm = 120000;
+			uint32_t measurements = 0;
+
+			bool write(const uint8_t* p, size_t n) override;
+			size_t read(uint8_t* p, size_t n) override;
+
+		private:
+			void reset_();
+			void trigger_();
+
+			uint8_t _regs[256] = {};
+			uint8_t _ptr = 0;
+	};
+
+	// ===== SGP30 (0x58) =====
+	// IAQinit 후 15초 동안은 데이터시트와 같이 400ppm/0ppb를 돌려줍니다.
+	class Sgp30Fake : public I2CDevice {
+		public:
+			uint16_t eco2 = 450;
+			uint16_t tvoc = 12;
+			uint16_t base_eco2 = 0x8A2E, base_tvoc = 0x8F11;
+			uint16_t humidity = 0;          // 마지막 setHumidity 값 (8.8 고정소수점 g/m3)
+			uint32_t measures = 0;
+
+			bool write(const uint8_t* p, size_t n) override;
+			size_t read(uint8_t* p, size_t n) override;
+
+		private:
+			void respond_(const uint16_t* w, uint8_t n);
+			uint8_t  _resp[9];
+			size_t   _resp_n = 0;
+			uint64_t _init_us = 0;
+			bool     _inited = false;
+	};
+
+	// ===== ZE07-CO (UART 능동 업로드) =====
+	// FF 04 03 01 HH LL FH FL CS, ppm × 10, 측정 범위 500ppm
+	void ze07Frame(uint8_t out[9], float ppm);
+
+} // namespace host
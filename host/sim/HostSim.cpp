@@ -0,0 +1,100 @@
+// =============================
+// File: host/sim/HostSim.cpp
+// =============================
+#include "HostSim.h"
+#include <malloc.h>
+#include <string.h>
+
+namespace host {
+
+namespace {
+	uint64_t   s_now_us = 0;
+	Account    s_main;
+	Account*   s_acc = &s_main;
+	I2CDevice* s_i2c[128] = {};
+	bool       s_console = true;
+	BlockHook  s_block = nullptr;
+
+	// 초기화 함수가 필요 없는 POD만 사용 (malloc 가로채기 안에서 접근)
+	uint64_t s_allocs = 0;
+	uint64_t s_bytes = 0;
+	uint64_t s_frees = 0;
+
+	inline void countAlloc(uint64_t n){ s_allocs++; s_bytes += n; s_acc->al.n++; s_acc->al.bytes += n; }
+	inline void countFree(){ s_frees++; s_acc->al.frees++; }
+}
+
+uint64_t nowUs(){ return s_now_us; }
+void advanceUs(uint64_t us){ s_now_us += us; }
+void blockUs(uint64_t us){
+	if(s_block) s_block(s_now_us + us);
+	else        idleUntilUs(s_now_us + us);
+}
+void idleUntilUs(uint64_t t_us){
+	if(t_us <= s_now_us) return;
+	s_acc->cnt.blocked_us += t_us - s_now_us;
+	s_now_us = t_us;
+}
+void setBlockHook(BlockHook fn){ s_block = fn; }
+void resetClock(uint64_t us){ s_now_us = us; s_acc->cnt = Counters(); }
+
+Counters& counters(){ return s_acc->cnt; }
+void addBusUs(uint64_t us){ s_now_us += us; s_acc->cnt.bus_us += us; }
+
+Allocs allocs(){ return s_acc->al; }
+
+Allocs allocsTotal(){
+	Allocs a;
+	a.n = s_allocs; a.bytes = s_bytes; a.frees = s_frees;
+	return a;
+}
+
+Account* setAccount(Account* a){
+	Account* prev = s_acc;
+	s_acc = a ? a : &s_main;
+	return prev;
+}
+
+void attachI2C(uint8_t addr, I2CDevice* dev){ if(addr < 128) s_i2c[addr] = dev; }
+void detachI2C(uint8_t addr){ if(addr < 128) s_i2c[addr] = nullptr; }
+I2CDevice* i2cDevice(uint8_t addr){ return addr < 128 ? s_i2c[addr] : nullptr; }
+
+void setConsole(bool on){ s_console = on; }
+bool console(){ return s_console; }
+
+uint8_t crc8(const uint8_t* p, size_t n){
+	uint8_t crc = 0xFF;
+	while(n--){
+		crc ^= *p++;
+		for(uint8_t k = 0; k < 8; k++) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+	}
+	return crc;
+}
+
+} // namespace host
+
+// ===== malloc 가로채기 (glibc) =====
+// operator new/std 컨테이너/printf 내부 버퍼도 결국 malloc을 거치므로 여기서 한 번에 셉니다.
+extern "C" {
+	void* __libc_malloc(size_t);
+	void* __libc_calloc(size_t, size_t);
+	void* __libc_realloc(void*, size_t);
+	void  __libc_free(void*);
+
+	void* malloc(size_t n){
+		host::countAlloc(n);
+		return __libc_malloc(n);
+	}
+	void* calloc(size_t c, size_t n){
+		host::countAlloc((uint64_t)c * n);
+		return __libc_calloc(c, n);
+	}
+	void* realloc(void* p, size_t n){
+		if(!p) host::countAlloc(n);
+		return __libc_realloc(p, n);
+	}
+	void free(void* p){
+		if(p) host::countFree();
+		__libc_free(p);
+	}
+}
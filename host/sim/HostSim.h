@@ -0,0 +1,88 @@
+// =============================
+// File: host/sim/HostSim.h
+// =============================
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// 리눅스 호스트 빌드용 시뮬레이션 환경
+// - 가상 시계: millis()/micros()/delay()/vTaskDelay()는 실제로 기다리지 않고 가상 시각만 진행합니다.
+//   I2C 전송도 (바이트 수 × 9비트 / 버스 클럭)만큼 가상 시각을 진행시키므로,
+//   "가상 경과 시간" = 드라이버가 실제 보드에서 버스/지연으로 막혀 있을 시간입니다.
+// - CPU 시간은 ESP.getCycleCount()(실제 시계 기반, 240MHz 환산) 또는 벤치의 std::chrono로 잽니다.
+// - 할당 계수: malloc/calloc/realloc을 가로채 현재 Task 계정에 셉니다.
+//   (보드의 heap_caps_get_info 차분과 달리 다른 Task의 할당이 섞이지 않음)
+// - FreeRTOS 심은 한 OS 스레드 안의 협력형 Task입니다. (shim/freertos/FreeRTOS.cpp)
+//   Task는 차단 대기(delay/vTaskDelay/알림/뮤텍스)에서만 전환되고, 모두 대기 중이면 가장 먼저 깨어날 시각으로 시계를 넘깁니다.
+namespace host {
+
+	// ===== 가상 시계 =====
+	uint64_t nowUs();
+	void advanceUs(uint64_t us);         // 버스 전송/계산 모델용 (대기 시간으로 세지 않음)
+	void blockUs(uint64_t us);           // delay()/vTaskDelay() 등 차단 대기 (Task 심이 있으면 다른 Task 실행)
+	void idleUntilUs(uint64_t t_us);     // 실행할 Task가 없을 때 시계를 t_us로 (blocked_us에 누적)
+	void resetClock(uint64_t us = 0);
+
+	// 차단 대기 훅: Task 심이 첫 Task를 만들 때 등록하며, 대기 동안 다른 Task를 가상 시각 순서로 돌립니다.
+	typedef void (*BlockHook)(uint64_t until_us);
+	void setBlockHook(BlockHook fn);
+
+	// ===== 누적 카운터 (가상 시간) =====
+	struct Counters {
+		uint64_t blocked_us = 0;         // 모든 Task가 대기 중이던 시간 (delay()/vTaskDelay()/알림 대기)
+		uint64_t bus_us = 0;             // I2C 전송 시간
+		uint32_t i2c_xfers = 0;          // I2C 트랜잭션 수 (START 기준)
+		uint32_t i2c_nacks = 0;          // 응답 없는 주소/데이터
+	};
+	Counters& counters();                // 현재 Task 계정
+	void addBusUs(uint64_t us);
+
+	// ===== 할당 계수 =====
+	struct Allocs {
+		uint64_t n = 0;                  // malloc/calloc/realloc(새 블록) 횟수
+		uint64_t bytes = 0;              // 요청 바이트 합
+		uint64_t frees = 0;
+	};
+	Allocs allocs();                     // 현재 Task 계정
+	Allocs allocsTotal();                // 프로세스 전체
+
+	// ===== Task별 계정 =====
+	// 카운터/할당 수는 실행 중인 Task의 계정에 쌓이며, Task 심이 전환할 때 setAccount()로 바꿉니다.
+	struct Account {
+		Counters cnt;
+		Allocs   al;
+	};
+	Account* setAccount(Account* a);     // nullptr = 메인 계정. 이전 계정 반환
+
+	// Task 심 상태 (벤치 리포트용)
+	struct TaskInfo {
+		const char*    name;
+		uint32_t       runs;             // 대기에서 깨어나 실행된 횟수
+		const Account* acc;
+	};
+	uint8_t taskInfo(TaskInfo* out, uint8_t max);   // 메인 제외, 만든 순서
+
+	// ===== I2C 장치 =====
+	// Wire 심이 주소별로 등록된 장치에 트랜잭션을 전달합니다.
+	// write(): 주소 뒤에 오는 바이트 (보통 레지스터 포인터 + 데이터). false면 NACK
+	// read():  요청 바이트 수만큼 채우고 실제로 채운 수 반환
+	// stop():  STOP 조건 (repeated start에서는 호출되지 않음)
+	class I2CDevice {
+		public:
+			virtual ~I2CDevice(){}
+			virtual bool write(const uint8_t* p, size_t n) = 0;
+			virtual size_t read(uint8_t* p, size_t n) = 0;
+			virtual void stop(){}
+	};
+	void attachI2C(uint8_t addr, I2CDevice* dev);
+	void detachI2C(uint8_t addr);
+	I2CDevice* i2cDevice(uint8_t addr);
+
+	// Serial(UART0) 출력을 stdout으로 보낼지 (기본 켬)
+	void setConsole(bool on);
+	bool console();
+
+	// Sensirion 명령 프로토콜 CRC-8 (poly 0x31, init 0xFF) — SPS30/SGP30 심과 가짜 장치 공용
+	uint8_t crc8(const uint8_t* p, size_t n);
+
+} // namespace host
@@ -0,0 +1,292 @@
+// =============================
+// File: host/test/test_filters.cpp
+// =============================
+// src/core/Filters.h 단위 테스트 + 벤치마크 (호스트)
+// - 단위: trimmedMean / Ema / EmaFixed(Ema<float> 기준) / Window / Median / TrimmedMean / Hampel(스파이크 대체, 계단 통과)
+//         / Welford(double 2-pass 기준, float 정밀도) / Biquad(gainAt ↔ 실제 응답)
+// - 벤치: 필터별 update 1회당 호스트 CPU 시간(ns)과 malloc 횟수 (모두 0이어야 함)
+//
+// 사용: test_filters [--quiet]
+#include <Arduino.h>
+#include <chrono>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include "HostSim.h"
+#include "../../src/core/Filters.h"
+
+namespace {
+	int s_fail = 0;
+	bool s_quiet = false;
+
+	void expect(bool ok, const char* what){
+		if(ok){ if(!s_quiet) printf("ok    %s\n", what); return; }
+		printf("FAIL  %s\n", what);
+		s_fail++;
+	}
+	bool near(double v, double want, double tol){ return fabs(v - want) <= tol; }
+
+	// ===== 단위 테스트 =====
+	void testTrimmedMean(){
+		int16_t s[10] = { 5, -3, 100, 7, 6, 4, -50, 5, 6, 4 };
+		// 정렬: -50 -3 | 4 4 5 5 6 6 | 7 100 → 양끝 2개씩 제외한 6개 평균
+		float m = filt::trimmedMean(s, 10, 2);
+		expect(near(m, (4 + 4 + 5 + 5 + 6 + 6) / 6.0, 1e-6), "trimmedMean drops both tails");
+		expect(s[0] == -50 && s[9] == 100, "trimmedMean sorts input in place");
+
+		int16_t one[1] = { 42 };
+		expect(near(filt::trimmedMean(one, 1, 3), 42.0, 1e-6), "trimmedMean clamps trim to leave one sample");
+		expect(isnan(filt::trimmedMean(one, 0, 0)), "trimmedMean of empty is NAN");
+	}
+
+	void testEma(){
+		filt::Ema<float> e(0.25f);
+		expect(!e.ready(), "Ema not ready before first sample");
+		expect(near(e.update(8.0f), 8.0, 0), "Ema initialises from first sample");
+		expect(near(e.update(0.0f), 6.0, 1e-6), "Ema step y += a(x - y)");
+		for(int i = 0; i < 200; i++) e.update(2.0f);
+		expect(near(e.value(), 2.0, 1e-5), "Ema converges to constant input");
+		e.set(1.0f);
+		expect(e.ready() && near(e.value(), 1.0, 0), "Ema set()");
+		e.reset();
+		expect(!e.ready() && e.value() == 0.0f, "Ema reset()");
+	}
+
+	void testEmaFixed(){
+		// alpha = 1/16: 같은 입력의 Ema<float>(1/16)와 정수 버림 오차(1 LSB) 이내
+		filt::EmaFixed<4> ef;
+		filt::Ema<float> e(1.0f / 16);
+		expect(!ef.ready(), "EmaFixed not ready before first sample");
+		expect(ef.update(1000) == 1000, "EmaFixed initialises from first sample");
+		e.update(1000.0f);
+		bool close = true;
+		for(int i = 0; i < 200; i++){
+			int32_t x = (i & 8) ? 1600 : -400;
+			close &= fabs(ef.update(x) - e.update((float)x)) <= 1.0;
+		}
+		expect(close, "EmaFixed tracks Ema<float> within 1 LSB");
+		for(int i = 0; i < 400; i++) ef.update(-250);
+		expect(abs(ef.value() + 250) <= 1, "EmaFixed converges to negative constant");
+		ef.reset();
+		expect(!ef.ready() && ef.value() == 0, "EmaFixed reset()");
+	}
+
+	void testWindow(){
+		filt::Window<4, int16_t> w;
+		expect(w.size() == 0 && !w.full(), "Window starts empty");
+		for(int16_t v = 1; v <= 6; v++) w.push(v);
+		expect(w.full() && w.size() == 4, "Window keeps N newest");
+		expect(w.at(0) == 3 && w.at(3) == 6 && w.last() == 6, "Window at(0) oldest, last() newest");
+		int16_t out[8];
+		expect(w.copyLast(out, 8) == 4 && out[0] == 3 && out[3] == 6, "Window copyLast clamps to size");
+		expect(w.copyLast(out, 2) == 2 && out[0] == 5 && out[1] == 6, "Window copyLast newest n");
+		w.reset();
+		expect(w.size() == 0, "Window reset()");
+	}
+
+	void testMedian(){
+		filt::Median<5, int16_t> m;
+		expect(m.value() == 0, "Median of empty is 0");
+		m.update(10); m.update(30);
+		expect(m.value() == 20, "Median even count averages middle pair");
+		m.update(500); m.update(20); m.update(25);
+		expect(m.value() == 25, "Median ignores single spike");
+		m.update(-1000);   // 창: 30 500 20 25 -1000
+		expect(m.value() == 25 && m.size() == 5, "Median slides window");
+	}
+
+	void testTrimmedMeanWindow(){
+		filt::TrimmedMean<6, 1, int16_t> t;
+		const int16_t in[] = { 100, 2, 4, 6, 8, -90 };
+		float v = 0;
+		for(int16_t x : in) v = t.update(x);
+		expect(near(v, (2 + 4 + 6 + 8) / 4.0, 1e-6), "TrimmedMean window drops one per side");
+		t.update(5);       // 창: 2 4 6 8 -90 5
+		expect(near(t.value(), (2 + 4 + 5 + 6) / 4.0, 1e-6), "TrimmedMean slides window");
+		t.reset();
+		expect(t.size() == 0 && isnan(t.value()), "TrimmedMean reset()");
+	}
+
+	void testHampel(){
+		// ADS1115 CO 링과 같은 구성: int16 원시값, 창 7, k=3
+		filt::Hampel<7, int16_t> h;
+		std::mt19937 rng(3);
+		std::uniform_int_distribution<int> noise(-3, 3);
+		for(int i = 0; i < 20; i++) h.update((int16_t)(6400 + noise(rng)));
+		expect(h.rejected() == 0, "Hampel passes in-band noise");
+
+		int16_t y = h.update(12000);
+		expect(h.outlier() && abs(y - 6400) <= 3, "Hampel replaces spike with median");
+		y = h.update(6401);
+		expect(!h.outlier() && y == 6401, "Hampel passes next normal sample");
+
+		// 실제 계단: 창의 절반 이상이 새 값이면 그대로 통과
+		int passed_at = -1;
+		for(int i = 0; i < 7; i++){
+			h.update((int16_t)(8000 + noise(rng)));
+			if(!h.outlier() && passed_at < 0) passed_at = i;
+		}
+		expect(passed_at >= 0 && passed_at <= 4, "Hampel passes a real step within half a window");
+
+		filt::Hampel<7, int16_t> flat;
+		for(int i = 0; i < 7; i++) flat.update(100);
+		expect(flat.update(101) == 101 && !flat.outlier(), "Hampel with MAD 0 does not reject");
+
+		h.reset();
+		expect(h.update(-5) == -5 && !h.outlier(), "Hampel reset() empties window");
+	}
+
+	void testWelford(){
+		// 큰 오프셋 + 작은 분산: 단순 합/제곱합 방식은 float에서 무너지는 경우
+		std::mt19937 rng(7);
+		std::normal_distribution<double> nd(0.0, 1.0);
+		std::vector<double> x(5000);
+		for(auto &v : x) v = 101325.0 + 3.0 * nd(rng);
+
+		filt::Welford<float> wf;
+		filt::Welford<double> wd;
+		for(double v : x){ wf.add((float)v); wd.add(v); }
+
+		double mean = 0;
+		for(double v : x) mean += v;
+		mean /= x.size();
+		double m2 = 0;
+		for(double v : x) m2 += (v - mean) * (v - mean);
+		double sd = sqrt(m2 / (x.size() - 1));
+
+		expect(wf.count() == x.size(), "Welford count");
+		expect(near(wd.mean(), mean, 1e-9) && near(wd.stddev(), sd, 1e-9), "Welford<double> matches two-pass");
+		// float 평균은 101325 근처 ulp(0.0078)의 수십 배 이내 (상대 2e-6), 표준편차는 1% 이내
+		expect(near(wf.mean(), mean, 0.2) && near(wf.stddev(), sd, 0.01 * sd), "Welford<float> stable at large offset");
+
+		// float 특수화가 double로 승격되지 않는지 (sqrtT(float) 선택)
+		static_assert(std::is_same<decltype(wf.stddev()), float>::value, "stddev keeps T");
+		static_assert(std::is_same<decltype(filt::sqrtT(1.0f)), float>::value, "sqrtT(float) -> float");
+
+		filt::Welford<float> w2;
+		w2.add(3.0f);
+		expect(w2.variance() == 0.0f && w2.stddev() == 0.0f, "Welford single sample has zero variance");
+		w2.add(-1.0f); w2.add(5.0f);
+		expect(w2.lowest() == -1.0f && w2.highest() == 5.0f, "Welford lowest/highest");
+		w2.reset();
+		expect(w2.count() == 0 && w2.mean() == 0.0f, "Welford reset()");
+	}
+
+	void testBiquad(){
+		// 2차 저역통과 (RBJ LPF): fs=1000Hz, fc=50Hz, Q=0.707
+		const float fs = 1000.0f, fc = 50.0f, q = 0.7071f;
+		float w0 = 2.0f * (float)M_PI * fc / fs, al = sinf(w0) / (2.0f * q), c = cosf(w0);
+		float a0 = 1.0f + al;
+		filt::Biquad bq;
+		bq.set((1.0f - c) / 2.0f / a0, (1.0f - c) / a0, (1.0f - c) / 2.0f / a0, -2.0f * c / a0, (1.0f - al) / a0);
+
+		expect(near(bq.gainAt(0.1f, fs), 1.0, 1e-3), "Biquad LPF DC gain 1");
+		expect(near(bq.gainAt(fc, fs), 0.7071, 0.01), "Biquad LPF -3 dB at fc");
+
+		// gainAt()과 실제 정현파 응답 진폭 비교
+		const float f = 120.0f;
+		float peak = 0.0f;
+		for(int n = 0; n < 4000; n++){
+			float y = bq.update(sinf(2.0f * (float)M_PI * f * n / fs));
+			if(n > 2000) peak = fmaxf(peak, fabsf(y));
+		}
+		expect(near(peak, bq.gainAt(f, fs), 0.01), "Biquad gainAt matches measured response");
+		bq.reset();
+		expect(bq.update(0.0f) == 0.0f, "Biquad reset()");
+	}
+
+	// ===== 벤치마크 =====
+	template <class Fn>
+	void bench(const char* name, uint32_t n, Fn fn){
+		host::Allocs a0 = host::allocs();
+		auto t0 = std::chrono::steady_clock::now();
+		fn(n);
+		auto t1 = std::chrono::steady_clock::now();
+		host::Allocs a1 = host::allocs();
+		double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+		uint64_t allocs = a1.n - a0.n;
+		printf("%-24s %10.1f %8llu\n", name, ns, (unsigned long long)allocs);
+		char what[64];
+		snprintf(what, sizeof(what), "%s allocation-free", name);
+		if(allocs) expect(false, what);
+	}
+
+	volatile float s_sink;
+
+	void runBench(){
+		printf("\n%-24s %10s %8s\n", "filter", "ns/update", "allocs");
+		std::vector<float> in(4096);
+		std::mt19937 rng(1);
+		std::uniform_real_distribution<float> ud(0.0f, 1000.0f);
+		for(auto &v : in) v = ud(rng);
+
+		bench("Ema<float>", 2000000, [&](uint32_t n){
+			filt::Ema<float> e(0.01f);
+			for(uint32_t i = 0; i < n; i++) e.update(in[i & 4095]);
+			s_sink = e.value();
+		});
+		bench("Welford<float>", 2000000, [&](uint32_t n){
+			filt::Welford<float> w;
+			for(uint32_t i = 0; i < n; i++) w.add(in[i & 4095]);
+			s_sink = w.stddev();
+		});
+		bench("Biquad", 2000000, [&](uint32_t n){
+			filt::Biquad b;
+			b.set(0.02f, 0.04f, 0.02f, -1.56f, 0.64f);
+			float y = 0;
+			for(uint32_t i = 0; i < n; i++) y = b.update(in[i & 4095]);
+			s_sink = y;
+		});
+		bench("EmaFixed<4>", 2000000, [&](uint32_t n){
+			filt::EmaFixed<4> e;
+			for(uint32_t i = 0; i < n; i++) e.update((int32_t)in[i & 4095]);
+			s_sink = (float)e.value();
+		});
+		bench("Median<7>", 200000, [&](uint32_t n){
+			filt::Median<7, int16_t> m;
+			int32_t acc = 0;
+			for(uint32_t i = 0; i < n; i++) acc += m.update((int16_t)in[i & 4095]);
+			s_sink = (float)acc;
+		});
+		bench("TrimmedMean<10, 2>", 200000, [&](uint32_t n){
+			filt::TrimmedMean<10, 2, int16_t> t;
+			float acc = 0;
+			for(uint32_t i = 0; i < n; i++) acc += t.update((int16_t)in[i & 4095]);
+			s_sink = acc;
+		});
+		// ADS1115 백그라운드 Task가 변환마다 채널당 1회 호출하는 구성
+		bench("Hampel<7, int16_t>", 200000, [&](uint32_t n){
+			filt::Hampel<7, int16_t> h;
+			int32_t acc = 0;
+			for(uint32_t i = 0; i < n; i++) acc += h.update((int16_t)in[i & 4095]);
+			s_sink = (float)acc;
+		});
+		bench("trimmedMean(10, 2)", 200000, [&](uint32_t n){
+			int16_t s[10];
+			float acc = 0;
+			for(uint32_t i = 0; i < n; i++){
+				for(uint8_t k = 0; k < 10; k++) s[k] = (int16_t)in[(i + k) & 4095];
+				acc += filt::trimmedMean(s, 10, 2);
+			}
+			s_sink = acc;
+		});
+	}
+}
+
+int main(int argc, char** argv){
+	for(int i = 1; i < argc; i++) if(!strcmp(argv[i], "--quiet")) s_quiet = true;
+
+	testTrimmedMean();
+	testEma();
+	testEmaFixed();
+	testWindow();
+	testMedian();
+	testTrimmedMeanWindow();
+	testHampel();
+	testWelford();
+	testBiquad();
+	runBench();
+
+	printf("\nFILTERS: %s (%d failed)\n", s_fail ? "FAIL" : "OK", s_fail);
+	return s_fail ? 1 : 0;
+}
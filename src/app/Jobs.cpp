@@ -0,0 +1,621 @@
+// =============================
+// File: app/Jobs.cpp
+// =============================
+#include "Jobs.h"
+#include <Preferences.h>
+#include <time.h>
+#include "../core/JsonOut.h"
+#include "../core/Metrics.h"
+#include "../core/TelemetryBin.h"
+#include "../core/LEDs.h"
+#include "../core/Power.h"
+
+// ---- 드라이버 ----
+#if USE_ADS1115 || USE_CO_ADC
+	ADS1115_Helper ads;
+#endif
+
+#if USE_MQ2
+	MQ2 mq2; MQ2Config mq2cfg;
+#endif
+
+#if USE_ZE07
+	ZE07 ze07;
+	HardwareSerial CO_SER(2);
+#endif
+
+#if USE_SEN0177
+	SEN0177 sen0177;
+	HardwareSerial PM_SER(1);
+#endif
+
+#if USE_BME688
+	BME68X bme688;
+#endif
+
+#if USE_SGP30
+	SGP30X sgp30;
+#endif
+
+#if USE_SPS30
+	SPS30X sps30;
+#endif
+
+#if USE_SMOKE2
+	SMOKE2 smoke2;
+#endif
+
+#if USE_ICS43434
+	ICS43434X mic;
+#endif
+
+// ---- 잡 공유 상태 ----
+TelemetryPool g_msgPool;
+Scheduler g_sched;
+telem::Sample g_sample;
+bool g_systemReady = false;
+cal::Curve g_cal_co(cal::GSET11_CO);
+cal::Curve g_cal_mq2(cal::MQ2_SMOKE);
+
+#if ENABLE_REPORT_BY_EXCEPTION
+static telem::Deadband g_rbe;   // 발행 잡 전용
+#endif
+#if ENABLE_ROLLUP
+static telem::Rollup g_rollup[ROLLUP_MAX];   // 발행 잡 전용, ROLLUP_WINDOWS 순서
+#endif
+static uint32_t s_dropped = 0;
+
+uint32_t epoch_now(){
+	time_t t = time(nullptr);
+	return (t > 1600000000) ? (uint32_t)t : 0;
+}
+
+// ---- 센서 잡 ----
+#if USE_SPS30
+#if ENABLE_LOW_POWER
+// 저전력 듀티 사이클: 깨움 → 팬 안정화 대기 → 1회 읽기 → 슬립, 다음 깨움은 깨운 시각 기준 LP_SPS30_PERIOD_MS 후
+static uint32_t s_sps30_awake_ms = 0;   // 마지막으로 깨운 시각 (부팅 시에는 begin()에서 측정 시작)
+#endif
+static uint32_t job_sps30(void*, uint32_t now){
+	PROF_SCOPE(SLOT_SPS30);
+	#if ENABLE_LOW_POWER
+		if(sps30.asleep()){
+			if(!sps30.wake()) return 0;
+			s_sps30_awake_ms = millis();
+			return LP_SPS30_SETTLE_MS;
+		}
+		uint32_t on = now - s_sps30_awake_ms;
+		if(on < LP_SPS30_SETTLE_MS) return LP_SPS30_SETTLE_MS - on;
+	#else
+		(void)now;
+	#endif
+	uint16_t pm1, pm25, pm4, pm10;
+	if(sps30.read(pm1,pm25,pm4,pm10)){
+		g_sample.setF(telem::F_PM1_0, pm1); g_sample.setF(telem::F_PM2_5, pm25);
+		g_sample.setF(telem::F_PM4_0, pm4); g_sample.setF(telem::F_PM10, pm10);
+	}
+	#if ENABLE_LOW_POWER
+		if(!sps30.sleep()) return 0;   // 슬립 실패 시 일반 주기로 계속 측정
+		uint32_t spent = millis() - s_sps30_awake_ms;
+		return spent < LP_SPS30_PERIOD_MS ? LP_SPS30_PERIOD_MS - spent : 1;
+	#else
+		return 0;
+	#endif
+}
+#endif
+
+#if USE_BME688
+// 2단계 잡: 변환 시작 → (히터 동작 동안 다른 잡 실행) → 완료 예정 시각에 다시 불려 결과 수집
+// 히터 프로파일 스캔 중에는 수집 직후 다음 단계 변환을 바로 시작하고, 한 바퀴가 끝나면 gas_fp 발행
+static uint32_t s_bme688_cycle_ms = 0;   // 이번 주기(스캔) 첫 변환 시작 시각
+static uint32_t job_bme688(void*, uint32_t now){
+	PROF_SCOPE(SLOT_BME688);
+	if(!bme688.busy()){
+		s_bme688_cycle_ms = now;
+		if(!bme688.startReading()) return 0;
+		uint32_t left = bme688.remainingMs();
+		return left ? left : 1;
+	}
+	uint32_t left = bme688.remainingMs();
+	if(left) return left;
+
+	float t,h,g;
+	if(bme688.collect(t,h,g)){
+		g_sample.setF(telem::F_TEMP, t); g_sample.setF(telem::F_HUM, h);
+		if(!bme688.scanning()){
+			float g_kohm = roundf((g * 0.001f) * 1000.0f) / 1000.0f;
+			g_sample.setF(telem::F_GAS_KOHM, g_kohm);
+		}
+	}
+	if(bme688.scanning()){
+		float fp[telem::VEC_MAX];
+		uint8_t n = bme688.takeScan(fp);
+		if(n) g_sample.setVec(telem::F_GAS_FP, fp, n);
+		if(bme688.scanStep() != 0 && bme688.startReading()){
+			left = bme688.remainingMs();
+			return left ? left : 1;
+		}
+	}
+	// 다음 변환은 이번 주기 시작 기준으로 (수집 시점 기준이면 변환시간만큼 주기가 밀림)
+	const uint32_t period = bme688.scanning() ? SENSOR_PERIOD_BME688_SCAN_MS : SENSOR_PERIOD_BME688_MS;
+	uint32_t spent = millis() - s_bme688_cycle_ms;
+	return spent < period ? period - spent : 1;
+}
+#endif
+
+#if USE_SMOKE2
+static uint32_t job_smoke2(void*, uint32_t){
+	PROF_SCOPE(SLOT_SMOKE2);
+	// 샘플별 판정은 SMOKE2 Task가 16Hz로 수행, 여기서는 직전 호출 이후 구간 집계만 가져옴
+	// (발행 주기와 같아야 구간 최대 score/경보가 발행 사이에 덮어써지지 않음)
+	SMOKE2::Reading sr;
+	if (smoke2.read(sr)) {
+		g_sample.setU(telem::F_SMK_BLUE, sr.blue); g_sample.setU(telem::F_SMK_IR, sr.ir);
+		g_sample.setF(telem::F_SMK_RATIO, sr.ratio); g_sample.setF(telem::F_SMK_ALPHA, sr.alpha);
+		g_sample.setF(telem::F_SMK_SCORE, sr.score); g_sample.setU(telem::F_SMK_ALARM, sr.alarm ? 1u : 0u);
+	}
+	return 0;
+}
+
+// SMOKE2 Task를 띄우지 못했을 때 대신 FIFO를 비움 (샘플별 판정/집계는 Task와 같음)
+static uint32_t job_smoke2_fifo(void*, uint32_t){
+	PROF_SCOPE(SLOT_SMOKE2);
+	smoke2.poll();
+	return 0;
+}
+#endif
+
+#if USE_SGP30
+// 기준선은 설정(sensor-hub)과 분리된 NVS 네임스페이스에 저장 (설정 버전 초기화와 무관하게 유지)
+// sensorTask에서 호출되므로 포털의 g_prefs와 겹치지 않도록 지역 Preferences 사용
+static bool s_sgp30_restore_pending = false;
+
+static void sgp30_baseline_save(uint16_t eco2_base, uint16_t tvoc_base){
+	Preferences p;
+	if(!p.begin("sgp30", false)) return;
+	p.putUShort("eco2_base", eco2_base);
+	p.putUShort("tvoc_base", tvoc_base);
+	p.putUInt("ts", epoch_now());
+	p.end();
+	Serial.printf("[SGP30] baseline saved eCO2=0x%04X TVOC=0x%04X\n", eco2_base, tvoc_base);
+}
+
+// 저장 시각이 7일 이내일 때만 복원. 시계 동기 전이면 false (다음 호출에서 재시도)
+static bool sgp30_baseline_restore(){
+	uint32_t now = epoch_now();
+	if(!now) return false;
+	s_sgp30_restore_pending = false;
+
+	Preferences p;
+	if(!p.begin("sgp30", true)) return true;
+	uint16_t eco2_base = p.getUShort("eco2_base", 0), tvoc_base = p.getUShort("tvoc_base", 0);
+	uint32_t ts = p.getUInt("ts", 0);
+	p.end();
+
+	if(!ts || now < ts || now - ts > SGP30X::BASELINE_MAX_AGE_S){
+		if(eco2_base) Serial.println(F("[SGP30] stored baseline too old or undated, relearning"));
+		return true;
+	}
+	if(sgp30.restoreBaseline(eco2_base, tvoc_base))
+		Serial.printf("[SGP30] baseline restored (%lu h old)\n", (unsigned long)((now - ts) / 3600));
+	return true;
+}
+
+static uint32_t job_sgp30(void*, uint32_t){
+	PROF_SCOPE(SLOT_SGP30);
+	if(s_sgp30_restore_pending) sgp30_baseline_restore();
+
+	#if USE_BME688
+		// BME688의 온도/습도로 절대습도 보정
+		float t = bme688.last_temperature(), rh = bme688.last_humidity();
+		if(isfinite(t) && isfinite(rh)) sgp30.setAbsHumidity(SGP30X::absHumidity(t, rh));
+	#endif
+
+	uint16_t eco2,tvoc;
+	if(sgp30.read(eco2,tvoc)){ g_sample.setU(telem::F_ECO2, eco2); g_sample.setU(telem::F_TVOC, tvoc); }
+
+	uint16_t eco2_base, tvoc_base;
+	if(sgp30.baselineDue(eco2_base, tvoc_base)) sgp30_baseline_save(eco2_base, tvoc_base);
+	return 0;
+}
+#endif
+
+#if USE_CO_ADC   // GSET11-P110 테이블 기준
+static uint32_t job_co_adc(void*, uint32_t){
+	PROF_SCOPE(SLOT_CO_ADC);
+
+	// ADS1115 백그라운드 링 버퍼의 최근 10개 샘플 평균
+	// 단발 스파이크는 링에 넣기 전 Hampel 필터가 중앙값으로 대체하므로 절사 없이 전부 평균
+	// (백그라운드 샘플이 아직 없으면 단발 변환 1회 값 사용)
+	float co_V = (ads.samples(0) > 0) ? ads.mean_V(0, 10) : ads.read_V(0);
+
+	// 구간 테이블(기본: GSET11-P110 4구간 2차식, 1.0V 이하 0ppm, 0~1000ppm 클램프)
+	float CO_ppm = g_cal_co.eval(co_V);
+
+	g_sample.setF(telem::F_CO_V, co_V);
+	g_sample.setF(telem::F_CO_PPM, CO_ppm);
+	return 0;
+}
+#endif
+
+#if USE_ADS1115 && USE_MQ2
+static uint32_t job_mq2(void*, uint32_t){
+	PROF_SCOPE(SLOT_MQ2);
+	float mq_mV = ads.read_mV(1);
+	mq2.update_from_adc_mV(mq_mV);
+	g_sample.setF(telem::F_MQ2_MV, mq_mV); g_sample.setF(telem::F_MQ2_RS, mq2.rs());
+	g_sample.setF(telem::F_MQ2_RATIO, mq2.ratio()); g_sample.setF(telem::F_MQ2_EMA, mq2.ratio_ema());
+	if(mq2.phase() == MQ2::RUN && !isnan(mq2.ratio_ema())) g_sample.setF(telem::F_MQ2_PPM, g_cal_mq2.eval(mq2.ratio_ema()));
+	leds::set3(mq2.alarm());
+	return 0;
+}
+#endif
+
+#if USE_ADS1115
+static uint32_t job_ads_aux(void*, uint32_t){
+	PROF_SCOPE(SLOT_ADS_AUX);
+	g_sample.setF(telem::F_SMOKE_MV, ads.read_mV(2));
+	return 0;
+}
+#endif
+
+#if USE_ICS43434
+static uint32_t job_mic(void*, uint32_t){
+	PROF_SCOPE(SLOT_MIC);
+	// 전용 reader Task가 갱신한 최신 구간 집계만 복사 (I2S 대기 없음)
+	ICS43434X::Levels lv;
+	if(mic.levels(lv, MIC_WINDOW_MS * 2)){
+		g_sample.setF(telem::F_MIC_RMS, lv.rms); g_sample.setF(telem::F_MIC_PEAK, lv.peak);
+		g_sample.setF(telem::F_MIC_LAEQ, lv.laeq); g_sample.setF(telem::F_MIC_LAEQ_LONG, lv.laeq_long);
+	}
+	return 0;
+}
+#endif
+
+#if USE_SEN0177
+static uint32_t job_sen0177(void*, uint32_t){
+	PROF_SCOPE(SLOT_SEN0177);
+	PM25Data d;
+	if(sen0177.read(d, SENSOR_PERIOD_UART_MS * 2)){ g_sample.setF(telem::F_PM1_0, d.pm1_0); g_sample.setF(telem::F_PM2_5, d.pm2_5); g_sample.setF(telem::F_PM10, d.pm10); }
+	return 0;
+}
+#endif
+
+#if USE_ZE07
+static uint32_t job_ze07(void*, uint32_t){
+	PROF_SCOPE(SLOT_ZE07);
+	if(ze07.latest_frame(SENSOR_PERIOD_UART_MS * 2)){ float ppm=0; uint16_t full=0; uint8_t dec=0; if(ze07.parse_ppm(ppm, full, dec)){ g_sample.setF(telem::F_ZE07_CO_PPM, ppm); } }
+	return 0;
+}
+#endif
+
+// 시스템이 아직 준비되지 않았다면, 센서들의 준비 상태를 확인
+static void check_system_ready(){
+	bool mq2_ready = false;
+	bool bme688_ready = false;
+	bool smoke2_ready = false;
+
+	#if USE_MQ2
+		mq2_ready = (mq2.phase() == MQ2::RUN);
+	#else
+		mq2_ready = true;
+	#endif
+
+	#if USE_BME688
+		// bme.isReading() 과 같은 명시적인 준비 함수가 없으므로,
+		// 첫 번째 유효한 가스 저항 값(0 이상)을 받으면 준비된 것으로 간주합니다.
+		bme688_ready = (bme688.last_gas_resistance() > 0);
+	#else
+		bme688_ready = true;
+	#endif
+
+	#if USE_SMOKE2
+		smoke2_ready = smoke2.isBaselineReady();
+	#else
+		smoke2_ready = true;
+	#endif
+
+	if (mq2_ready && bme688_ready && smoke2_ready) {
+		g_systemReady = true;
+		Serial.println("[SYSTEM] All sensors are ready. Starting MQTT publish.");
+	} else {
+		// 디버깅: 어떤 센서가 아직 준비되지 않았는지 확인
+		Serial.printf("[SYSTEM] Waiting for sensors... MQ2: %d, BME688: %d, SMOKE2: %d\n",
+			(int)mq2_ready, (int)bme688_ready, (int)smoke2_ready
+		);
+	}
+}
+
+// 경보가 켜진 샘플은 MQTT 묶음 발행을 기다리지 않도록 표시
+static uint8_t sample_flags(const telem::Sample &sample){
+	bool alarm = sample.has(telem::F_SMK_ALARM) && sample.u(telem::F_SMK_ALARM);
+	#if USE_ADS1115 && USE_MQ2
+		alarm = alarm || mq2.alarm();
+	#endif
+	return alarm ? MSG_F_ALARM : 0;
+}
+
+// 풀의 슬롯에 페이로드를 직접 작성하고 슬롯 포인터만 MQTT Task로 전달 (복사 없음)
+#if TELEMETRY_JSON
+static void publish_json(const telem::Sample &sample){
+	TelemetryPool::Msg *msg = g_msgPool.acquire();
+	if (!msg) {
+		Serial.println("Sensor Task: No free message slot, sample dropped");
+		s_dropped++;
+		return;
+	}
+
+	JsonBuf js(msg->data, sizeof(msg->data));
+	uint32_t ts = epoch_now();
+	if (ts) js.addU("ts", ts); // 재전송 레코드 식별을 위해 항상 첫 키
+	telem::writeJson(js, sample);
+	msg->len = (uint16_t)js.finish();
+	msg->tag = MSG_TELEMETRY;
+	msg->flags = sample_flags(sample);
+
+	if (js.overflow()) {
+		Serial.println("Sensor Task: JSON buffer overflow, sample dropped");
+		s_dropped++;
+		g_msgPool.release(msg);
+	} else if (!g_msgPool.post(msg)) {
+		Serial.println("Sensor Task: Failed to send to queue, queue full?");
+		s_dropped++;
+	}
+}
+#endif
+
+#if TELEMETRY_BINARY
+static void publish_binary(const telem::Sample &sample){
+	static_assert(telem::TELEM_BIN_MAX <= TELEMETRY_SLOT_SIZE, "binary record exceeds slot");
+	TelemetryPool::Msg *msg = g_msgPool.acquire();
+	if (!msg) {
+		Serial.println("Sensor Task: No free message slot, binary sample dropped");
+		s_dropped++;
+		return;
+	}
+
+	msg->len = (uint16_t)telem::encodeBinary(sample, epoch_now(), (uint8_t*)msg->data, sizeof(msg->data));
+	msg->tag = MSG_TELEMETRY_BIN;
+	msg->flags = sample_flags(sample);
+	if (!g_msgPool.post(msg)) {
+		Serial.println("Sensor Task: Failed to send to queue, queue full?");
+		s_dropped++;
+	}
+}
+#endif
+
+#if ENABLE_ROLLUP
+// 창 하나의 통계를 JSON으로 발행. 슬롯 하나에 다 들어가지 않으면 필드를 나누어 여러 메시지로 보냅니다.
+// 각 메시지에는 ts(창 종료), win(초), t0(창 시작, 시계 동기 시)가 함께 들어갑니다.
+static void publish_rollup(uint8_t k){
+	const telem::Rollup &r = g_rollup[k];
+	if (r.empty()) return;
+	uint32_t ts = epoch_now();
+	uint8_t from = 0;
+	while (from < telem::FIELD_COUNT) {
+		TelemetryPool::Msg *msg = g_msgPool.acquire();
+		if (!msg) {
+			Serial.println("Sensor Task: No free message slot, rollup dropped");
+			s_dropped++;
+			return;
+		}
+		JsonBuf js(msg->data, sizeof(msg->data));
+		if (ts) js.addU("ts", ts);
+		js.addU("win", r.window());
+		if (r.startEpoch()) js.addU("t0", r.startEpoch());
+		uint8_t next = r.writeJson(js, from);
+		msg->len = (uint16_t)js.finish();
+		msg->tag = MSG_ROLLUP + k;
+		if (next == from || msg->len == 0) {   // 필드 하나도 못 씀 (슬롯 크기 설정 오류)
+			g_msgPool.release(msg);
+			return;
+		}
+		from = next;
+		if (!g_msgPool.post(msg)) {
+			Serial.println("Sensor Task: Failed to send rollup to queue, queue full?");
+			s_dropped++;
+			return;
+		}
+	}
+}
+
+// 매 발행 주기 스냅샷을 모든 창에 누적하고, 끝난 창은 발행 후 다음 창 시작
+// 여러 창이 함께 끝나면(예: 정각 15분) 풀 슬롯이 몰리지 않도록 주기당 한 창만 발행
+static void rollup_step(const telem::Sample &sample){
+	uint32_t now = millis();
+	for (uint8_t k = 0; k < ROLLUP_COUNT; k++) g_rollup[k].add(sample);
+	for (uint8_t k = 0; k < ROLLUP_COUNT; k++) {
+		if (!g_rollup[k].due(now)) continue;
+		publish_rollup(k);
+		g_rollup[k].next(now, epoch_now());
+		break;
+	}
+}
+#endif
+
+#if ENABLE_METRICS
+// 운영 지표를 MQTT_METRICS_TOPIC에 발행 (시스템 → 스케줄러 → 잡 히스토그램 순으로 슬롯 크기에 맞춰 나눔)
+// 각 메시지에는 ts(시계 동기 시)와 up(가동 초)이 들어가 수집 측에서 같은 주기의 조각을 묶을 수 있습니다.
+static bool post_metrics(JsonBuf &js, TelemetryPool::Msg *msg){
+	msg->len = (uint16_t)js.finish();
+	msg->tag = MSG_METRICS;
+	msg->flags = 0;
+	if (msg->len == 0) {
+		Serial.println("Sensor Task: metrics JSON overflow");
+		g_msgPool.release(msg);
+		return false;
+	}
+	return g_msgPool.post(msg);
+}
+
+static void publish_metrics(){
+	uint32_t ts = epoch_now();
+	uint32_t up = millis() / 1000;
+	uint8_t part = 0;
+	uint8_t from = 0;
+	while (part < 2 || from < prof::SLOT_COUNT) {
+		TelemetryPool::Msg *msg = g_msgPool.acquire();
+		if (!msg) return;   // 텔레메트리 우선, 이번 주기 지표는 생략
+		JsonBuf js(msg->data, sizeof(msg->data));
+		if (ts) js.addU("ts", ts);
+		js.addU("up", up);
+		if (part == 0) {
+			metrics::writeSystem(js);
+		} else if (part == 1) {
+			metrics::writeSched(js);
+		} else {
+			js.beginObj("lat");
+			uint8_t next = metrics::writeLatency(js, from);
+			js.endObj();
+			if (next == from) {   // 히스토그램 하나도 못 씀 (슬롯 크기 설정 오류)
+				g_msgPool.release(msg);
+				return;
+			}
+			from = next;
+		}
+		part++;
+		if (!post_metrics(js, msg)) return;
+	}
+}
+
+static uint32_t job_metrics(void*, uint32_t){
+	publish_metrics();   // 예열 중에도 발행 (부팅 직후 힙/스택 확인용)
+	return 0;
+}
+#endif
+
+// 1초마다 최신 스냅샷을 직렬화하여 Queue에 전송
+static uint32_t job_publish(void*, uint32_t){
+	#if ENABLE_CYCLE_PROFILE
+	prof::report(Serial);
+	#endif
+
+	if (!g_systemReady) check_system_ready();
+
+	leds::blink3(1);
+
+	#if ENABLE_METRICS
+		metrics::sample();   // 게이지 최대값 (큐 깊이 등)
+	#endif
+
+	#if ENABLE_ROLLUP
+		if (g_systemReady) rollup_step(g_sample);   // 예외 보고로 걸러지기 전의 전체 스냅샷
+	#endif
+
+	if (!g_systemReady || g_sample.empty()) {
+		g_sample.clear();
+		return 0;
+	}
+
+	PROF_SCOPE(SLOT_PUBLISH);
+	#if ENABLE_LOW_POWER
+		g_sample.setU(telem::F_AWAKE_MS, power::takeAwakeMs());
+	#endif
+	#if ENABLE_REPORT_BY_EXCEPTION
+		// 데드밴드/하트비트 기준으로 변한 필드만 남김 (경보 샘플은 전체)
+		g_sample.mask = g_rbe.filter(g_sample, millis(), sample_flags(g_sample) != 0);
+		if (g_sample.empty()) return 0;
+	#endif
+	#if TELEMETRY_JSON
+		publish_json(g_sample);
+	#endif
+	#if TELEMETRY_BINARY
+		publish_binary(g_sample);
+	#endif
+	g_sample.clear(); // 다음 발행까지 새로 갱신된 필드만 출력
+	return 0;
+}
+
+// ---- 등록 / 사이클 ----
+namespace jobs {
+
+namespace {
+	int8_t s_id_smoke2 = -1;
+	int8_t s_id_publish = -1;
+
+	int8_t add_(AddFn add, const char* name, uint32_t period_ms, Scheduler::JobFn fn, uint32_t phase_ms = 0, int8_t slot = -1){
+		if(add) return add(name, period_ms, fn, phase_ms, slot);
+		return g_sched.add(name, period_ms, fn, nullptr, phase_ms);
+	}
+}
+
+void addSensors(AddFn add){
+	// BME688은 가장 먼저 변환을 시작시켜 히터 동작(~150ms) 동안 나머지 센서를 읽음
+	#if USE_BME688
+		add_(add, "bme688", SENSOR_PERIOD_BME688_MS, job_bme688, 0, prof::SLOT_BME688);
+	#endif
+	#if USE_SMOKE2
+		s_id_smoke2 = add_(add, "smoke2", SENSOR_PERIOD_SMOKE2_MS, job_smoke2, 0, prof::SLOT_SMOKE2);
+		if (!smoke2.taskRunning()) add_(add, "smoke2_fifo", SENSOR_PERIOD_SMOKE2_FIFO_MS, job_smoke2_fifo, 0, prof::SLOT_SMOKE2);
+		smoke2.setAlarmNotify(xTaskGetCurrentTaskHandle()); // 경보 상승 시 waitNext()에서 즉시 깨어남
+	#endif
+	#if USE_SGP30
+		add_(add, "sgp30", SENSOR_PERIOD_SGP30_MS, job_sgp30, 0, prof::SLOT_SGP30);
+	#endif
+	#if USE_SPS30
+		add_(add, "sps30", SENSOR_PERIOD_SPS30_MS, job_sps30, 0, prof::SLOT_SPS30);
+	#endif
+	#if USE_CO_ADC
+		add_(add, "co_adc", SENSOR_PERIOD_ADC_MS, job_co_adc, 0, prof::SLOT_CO_ADC);
+	#endif
+	#if USE_ADS1115 && USE_MQ2
+		add_(add, "mq2", SENSOR_PERIOD_ADC_MS, job_mq2, 0, prof::SLOT_MQ2);
+	#endif
+	#if USE_ADS1115
+		add_(add, "ads_aux", SENSOR_PERIOD_ADC_MS, job_ads_aux, 0, prof::SLOT_ADS_AUX);
+	#endif
+	#if USE_ICS43434
+		add_(add, "mic", SENSOR_PERIOD_MIC_MS, job_mic, 0, prof::SLOT_MIC);
+	#endif
+	#if USE_SEN0177
+		add_(add, "sen0177", SENSOR_PERIOD_UART_MS, job_sen0177, 0, prof::SLOT_SEN0177);
+	#endif
+	#if USE_ZE07
+		add_(add, "ze07", SENSOR_PERIOD_UART_MS, job_ze07, 0, prof::SLOT_ZE07);
+	#endif
+	#if ENABLE_ROLLUP
+		for (uint8_t k = 0; k < ROLLUP_COUNT; k++) g_rollup[k].begin(ROLLUP_WINDOWS[k], millis(), epoch_now());
+	#endif
+}
+
+void addPublish(AddFn add){
+	#if ENABLE_METRICS
+		add_(add, "metrics", METRICS_PERIOD_MS, job_metrics, METRICS_PERIOD_MS);
+		metrics::setScheduler(&g_sched);
+	#endif
+	s_id_publish = add_(add, "publish", PUBLISH_PERIOD_MS, job_publish, PUBLISH_PERIOD_MS, prof::SLOT_PUBLISH);
+}
+
+void wait(){
+	g_sched.waitNext();
+	#if USE_SMOKE2
+	// 연기 경보가 켜지면 다음 1초 주기를 기다리지 않고 집계 → 발행 (MSG_F_ALARM으로 묶음 발행도 즉시 flush)
+	if (smoke2.takeAlarmEdge()) { g_sched.kick(s_id_smoke2); g_sched.kick(s_id_publish); }
+	#endif
+}
+
+void dispatch(){
+	#if ENABLE_CYCLE_PROFILE
+	prof::begin(prof::SLOT_CYCLE);
+	#elif ENABLE_METRICS
+	uint32_t cycle_t0 = metrics::ticks();
+	#endif
+	power::awakeBegin();
+	g_sched.dispatch();
+	power::awakeEnd();
+	#if ENABLE_CYCLE_PROFILE
+	prof::end(prof::SLOT_CYCLE);
+	#elif ENABLE_METRICS
+	metrics::record(prof::SLOT_CYCLE, metrics::ticksToUs(metrics::ticks() - cycle_t0));
+	#endif
+}
+
+void restoreSgp30Baseline(){
+	#if USE_SGP30
+	s_sgp30_restore_pending = true;
+	#endif
+}
+
+uint32_t dropped(){ return s_dropped; }
+
+} // namespace jobs
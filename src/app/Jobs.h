@@ -0,0 +1,135 @@
+// =============================
+// File: app/Jobs.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include "../config/BuildOpts.h"
+#include "../config/Features.h"
+#include "../core/Profiler.h"
+#include "../core/Scheduler.h"
+#include "../core/Telemetry.h"
+#include "../core/MsgPool.h"
+#include "../core/CalCurve.h"
+#include "../core/Deadband.h"
+#include "../core/Rollup.h"
+#include "../drivers/ADS1115_Helper.h"
+#include "../drivers/MQ2.h"
+#include "../drivers/ZE07.h"
+#include "../drivers/SEN0177.h"
+#include "../drivers/BME68X.h"
+#include "../drivers/SGP30X.h"
+#include "../drivers/SMOKE2.h"
+#include "../drivers/SPS30X.h"
+#if USE_ICS43434
+	#include "../drivers/ICS43434X.h"
+#endif
+
+// sensorTask 잡 (센서 읽기 → g_sample, 발행 잡 → 메시지 풀)
+// 스케치(ait_wifi_G.ino)와 호스트 벤치(host/bench/cycle_bench.cpp)가 같은 본문을 컴파일합니다.
+// - 각 센서는 자기 주기로 읽혀 g_sample에 최신 값을 기록하고,
+//   발행 잡이 1초마다 g_sample을 JSON/바이너리로 만들어 g_msgPool로 MQTT Task에 넘깁니다.
+// - 모든 잡은 sensorTask 안에서 실행되므로 g_sample 접근에 잠금이 필요 없습니다.
+// - 드라이버 초기화(setup)와 Wi-Fi/MQTT/포털/스풀/워밍 스냅샷은 스케치에 있습니다.
+
+#define SENSOR_PERIOD_SMOKE2_MS   PUBLISH_PERIOD_MS  // 발행 주기마다 구간 집계를 가져옴 (경보 상승 시 즉시 kick)
+#define SENSOR_PERIOD_SMOKE2_FIFO_MS 250 // SMOKE2 Task가 없을 때만: ~16Hz, FIFO(16패킷) 오버플로 전에 버스트로 비움
+#define SENSOR_PERIOD_SGP30_MS    1000  // IAQmeasure는 정확히 1Hz 권장
+#define SENSOR_PERIOD_SPS30_MS    1000  // SPS30 측정값 1초 갱신
+#define SENSOR_PERIOD_BME688_MS   1000
+#define SENSOR_PERIOD_BME688_SCAN_MS 3000  // 히터 프로파일 스캔 1회 주기 (ENABLE_BME688_SCAN)
+#define SENSOR_PERIOD_ADC_MS      1000  // CO/MQ2/Smoke (ADS1115 링 버퍼 조회)
+#define SENSOR_PERIOD_UART_MS     1000  // ZE07/SEN0177 (1초 주기 프레임, 수신 콜백이 보관한 최신 프레임 조회)
+#define SENSOR_PERIOD_MIC_MS      1000
+#define PUBLISH_PERIOD_MS         1000
+
+// 센서 Task -> MQTT Task 전달용 메시지 풀
+// 페이로드는 수백 바이트이므로 슬롯은 1KB로 두고, Queue로는 슬롯 포인터만 전달합니다.
+#define TELEMETRY_SLOT_SIZE   1024
+#define TELEMETRY_POOL_SLOTS  6
+typedef MsgPool<TELEMETRY_POOL_SLOTS, TELEMETRY_SLOT_SIZE> TelemetryPool;
+
+// 메시지 슬롯의 tag → 발행 토픽
+enum MsgTag : uint8_t {
+	MSG_TELEMETRY = 0,   // JSON  → MQTT_TOPIC
+	MSG_TELEMETRY_BIN,   // 바이너리 → MQTT_TOPIC_BIN
+	MSG_BATCH_TAGS,      // 여기까지 묶음 발행 대상
+	MSG_ROLLUP = MSG_BATCH_TAGS,   // 구간 통계 JSON → MQTT_TOPIC_ROLLUP/<창> (tag = MSG_ROLLUP + 창 인덱스, 묶지 않음)
+	MSG_METRICS = MSG_ROLLUP + ROLLUP_MAX,   // 운영 지표 JSON → MQTT_METRICS_TOPIC (묶지 않음, 단절 시 버림)
+};
+
+// 메시지 슬롯 flags
+#define MSG_F_ALARM  0x01   // 경보 샘플 → 묶음 발행 중이면 즉시 flush
+
+#if ENABLE_ROLLUP
+static const uint32_t ROLLUP_WINDOWS[] = { ROLLUP_WINDOWS_S };
+static constexpr uint8_t ROLLUP_COUNT = sizeof(ROLLUP_WINDOWS) / sizeof(ROLLUP_WINDOWS[0]);
+static_assert(ROLLUP_COUNT <= ROLLUP_MAX, "too many rollup windows");
+#endif
+
+// ---- 드라이버 ----
+#if USE_ADS1115 || USE_CO_ADC
+	extern ADS1115_Helper ads;
+#endif
+#if USE_MQ2
+	extern MQ2 mq2;
+	extern MQ2Config mq2cfg;
+#endif
+#if USE_ZE07
+	extern ZE07 ze07;
+	extern HardwareSerial CO_SER;
+#endif
+#if USE_SEN0177
+	extern SEN0177 sen0177;
+	extern HardwareSerial PM_SER;
+#endif
+#if USE_BME688
+	extern BME68X bme688;
+#endif
+#if USE_SGP30
+	extern SGP30X sgp30;
+#endif
+#if USE_SPS30
+	extern SPS30X sps30;
+#endif
+#if USE_SMOKE2
+	extern SMOKE2 smoke2;
+#endif
+#if USE_ICS43434
+	extern ICS43434X mic;
+#endif
+
+// ---- 잡 공유 상태 ----
+extern TelemetryPool g_msgPool;
+extern Scheduler g_sched;
+extern telem::Sample g_sample;
+extern bool g_systemReady;   // 모든 센서가 안정화되었는지 (발행 시작 조건)
+
+// 교정 곡선: 기본 테이블로 시작하고 setup()에서 NVS("cal") 장치별 테이블이 있으면 교체
+// 포털 저장 후 재부팅 시에만 바뀌므로 sensorTask에서 잠금 없이 사용
+extern cal::Curve g_cal_co;
+extern cal::Curve g_cal_mq2;
+
+// SNTP로 동기화된 epoch 초 (아직 동기화 전이면 0)
+uint32_t epoch_now();
+
+namespace jobs {
+	// 잡 등록 훅 (벤치의 잡별 측정 래퍼용). slot < 0 이면 프로파일 슬롯 없는 잡
+	typedef int8_t (*AddFn)(const char* name, uint32_t period_ms, Scheduler::JobFn fn, uint32_t phase_ms, int8_t slot);
+
+	// 센서 잡 등록 + 롤업 창 시작. 같은 마감시각이면 등록 순서대로 실행되므로
+	// 스케치 전용 잡은 addSensors()와 addPublish() 사이에 등록합니다.
+	void addSensors(AddFn add = nullptr);
+	// 지표 + 발행 잡 등록 (발행 잡은 항상 마지막)
+	void addPublish(AddFn add = nullptr);
+
+	// 가장 이른 마감시각까지 대기. 연기 경보가 켜지면 smoke2/발행 잡을 다음 주기를 기다리지 않고 실행
+	void wait();
+	// 마감된 잡 실행 (사이클 프로파일/지표, 저전력 모드 작업 시간 포함)
+	void dispatch();
+
+	// setup()에서 SGP30 begin() 성공 후 호출: 시계가 맞으면 첫 sgp30 잡에서 NVS 기준선 복원
+	void restoreSgp30Baseline();
+
+	// 슬롯 부족/JSON 넘침/큐 가득 참으로 버린 텔레메트리/롤업 메시지 수
+	uint32_t dropped();
+} // namespace jobs
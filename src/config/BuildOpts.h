@@ -12,5 +12,111 @@
 // I2C speed - 400kHz
 #ifndef I2C_FREQ_HZ
     //#define I2C_FREQ_HZ 400000
-    #define I2C_FREQ_HZ 100000          // SPS30 은 100KHz 동작
+    #define I2C_FREQ_HZ 100000          // 부팅 시 기본 클럭 (SPS30 은 100KHz 동작, 장치별 클럭은 아래 I2C_HZ_*)
+#endif
+
+
+// sensorTask 사이클 프로파일링 (드라이버별 소요시간/힙 변화를 Serial로 출력)
+#ifndef ENABLE_CYCLE_PROFILE
+    #define ENABLE_CYCLE_PROFILE 0
+#endif
+
+// 프로파일 리포트 주기 (사이클 수)
+#ifndef PROF_REPORT_EVERY
+    #define PROF_REPORT_EVERY 10
+#endif
+
+
+// 텔레메트리 인코딩 선택 (둘 다 켜면 같은 샘플을 두 토픽에 병행 발행)
+// JSON   : sensorhub/telemetry
+// BINARY : sensorhub/telemetry/bin (core/TelemetryBin.h 레코드, tools/telemetry_bin_decode.py로 디코딩)
+#ifndef TELEMETRY_JSON
+    #define TELEMETRY_JSON 1
+#endif
+#ifndef TELEMETRY_BINARY
+    #define TELEMETRY_BINARY 0
+#endif
+
+
+// MQTT/Wi-Fi 단절 중 텔레메트리를 LittleFS에 보관했다가 재연결 시 재전송 (core/FlashSpool.h)
+#ifndef ENABLE_FLASH_SPOOL
+    #define ENABLE_FLASH_SPOOL 1
+#endif
+
+
+// BME688 히터 프로파일 스캔 (BME68X::DEFAULT_PROFILE, 스캔마다 gas_fp 배열 발행 / gas_kohm 대신)
+#ifndef ENABLE_BME688_SCAN
+    #define ENABLE_BME688_SCAN 0
+#endif
+
+
+// 저전력 모드 (core/Power.h)
+// - esp_pm DFS + 자동 light sleep (CONFIG_PM_ENABLE 빌드에서만), Wi-Fi 모뎀 슬립 + 리슨 인터벌
+// - SPS30 듀티 사이클(깨움 → 안정화 → 1회 측정 → 슬립), BME688 가스 히터 간헐 동작
+// - 발행마다 sensorTask 작업 시간(awake_ms) 보고
+#ifndef ENABLE_LOW_POWER
+    #define ENABLE_LOW_POWER 0
+#endif
+#ifndef LP_WIFI_LISTEN_INTERVAL
+    #define LP_WIFI_LISTEN_INTERVAL 3       // AP 비콘 3개(≈300ms)마다 수신
+#endif
+#ifndef LP_SPS30_PERIOD_MS
+    #define LP_SPS30_PERIOD_MS 300000       // SPS30 측정 주기
+#endif
+#ifndef LP_SPS30_SETTLE_MS
+    #define LP_SPS30_SETTLE_MS 30000        // 깨운 뒤 팬 안정화 대기 (데이터시트 최대 30초)
+#endif
+#ifndef LP_BME688_GAS_EVERY
+    #define LP_BME688_GAS_EVERY 10          // BME688 측정 10회 중 1회만 가스 히터 사용
+#endif
+
+
+// 예외 보고 (core/Deadband.h): 필드별 데드밴드를 넘었거나 하트비트가 지난 필드만 발행
+// 경보 필드(smk_alarm)는 값이 바뀔 때마다, 경보 중인 샘플은 전체 필드 발행. 모든 필드가 걸러지면 그 주기는 발행 생략
+#ifndef ENABLE_REPORT_BY_EXCEPTION
+    #define ENABLE_REPORT_BY_EXCEPTION 1
+#endif
+#ifndef RBE_HEARTBEAT_S
+    #define RBE_HEARTBEAT_S 300             // 변화가 없어도 5분마다 발행
+#endif
+
+
+// 구간 통계 발행 (core/Rollup.h): 창마다 필드별 min/max/mean/sd/n을 MQTT_TOPIC_ROLLUP/<창>에 발행
+// ROLLUP_WINDOWS_S: 창 길이(초) 목록, 최대 ROLLUP_MAX개 (토픽 예: sensorhub/rollup/1m, sensorhub/rollup/15m)
+#ifndef ENABLE_ROLLUP
+    #define ENABLE_ROLLUP 1
+#endif
+#ifndef ROLLUP_WINDOWS_S
+    #define ROLLUP_WINDOWS_S 60, 900
+#endif
+#define ROLLUP_MAX 4
+
+
+// 운영 지표 (core/Metrics.h): 잡별 소요시간 히스토그램, 큐 깊이, 힙/단편화, Task 스택 여유, I2C/스케줄러 통계
+// METRICS_PERIOD_MS마다 MQTT_METRICS_TOPIC에 JSON 발행, STA 모드에서는 http://<ip>/metrics 로 텍스트(Prometheus 형식) 제공
+#ifndef ENABLE_METRICS
+    #define ENABLE_METRICS 1
+#endif
+#ifndef METRICS_PERIOD_MS
+    #define METRICS_PERIOD_MS 60000
+#endif
+
+
+// ICS43434 마이크 집계 구간 (drivers/ICS43434X.h 전용 reader Task)
+// MIC_WINDOW_MS마다 RMS/피크/A가중 Leq, 최근 MIC_LEQ_WINDOWS개 구간으로 긴 구간 Leq (기본 1분)
+#ifndef MIC_WINDOW_MS
+    #define MIC_WINDOW_MS 1000
+#endif
+#ifndef MIC_LEQ_WINDOWS
+    #define MIC_LEQ_WINDOWS 60
+#endif
+
+
+// I2C 장치별 클럭 (core/I2CBus.h의 i2cbus::Guard가 장치 접근 시 전환)
+// SPS30만 100kHz 제한, 나머지(BME688/SGP30/ADS1115/ADPD188)는 400kHz 지원
+#ifndef I2C_HZ_FAST
+    #define I2C_HZ_FAST 400000
+#endif
+#ifndef I2C_HZ_SPS30
+    #define I2C_HZ_SPS30 100000
 #endif
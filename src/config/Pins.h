@@ -18,6 +18,13 @@
 #define PIN_I2C_SCL 	9
 
 
+// ADS1115 ALERT/RDY (미연결 시 -1 → 타이머 페이싱)
+#define PIN_ADS_RDY 	-1
+
+// SMOKE2(ADPD188) GPIO0 FIFO 워터마크 인터럽트 (미연결 시 -1 → FIFO 상태 폴링)
+#define PIN_SMOKE2_INT 	-1
+
+
 // I2S (ICS-43434)
 #define PIN_I2S_BCLK 	14
 #define PIN_I2S_LRCK 	15
@@ -0,0 +1,194 @@
+// =============================
+// File: core/CalCurve.cpp
+// =============================
+#include "CalCurve.h"
+#include <Preferences.h>
+
+namespace cal {
+
+namespace {
+	constexpr const char* NVS_NS = "cal";
+	constexpr uint16_t BLOB_MAGIC = 0x4C43;   // "CL"
+	constexpr uint8_t  BLOB_VER = 1;
+
+	struct Blob {
+		uint16_t magic;
+		uint8_t  ver;
+		uint8_t  rsv;
+		Table    t;
+	};
+
+	const char* const INTERP_NAMES[] = { "poly", "linear", "loglog" };
+
+	// "a,b" 형태 float 2개
+	bool parsePair_(const char* &p, float &a, float &b){
+		char *end;
+		a = strtof(p, &end); if(end == p || *end != ',') return false;
+		p = end + 1;
+		b = strtof(p, &end); if(end == p) return false;
+		p = end;
+		return true;
+	}
+}
+
+bool Curve::valid(const Table &t){
+	if(t.interp > LOGLOG) return false;
+	uint8_t min_n = (t.interp == POLY) ? 1 : 2;
+	if(t.n < min_n || t.n > SEG_MAX) return false;
+	if(!(t.y_min <= t.y_max)) return false;
+	for(uint8_t i = 0; i < t.n; i++){
+		if(!isfinite(t.x[i])) return false;
+		if(i > 0 && !(t.x[i] > t.x[i - 1])) return false;
+		uint8_t nc = (t.interp == POLY) ? COEF_MAX : 1;
+		for(uint8_t k = 0; k < nc; k++) if(!isfinite(t.c[i][k])) return false;
+		if(t.interp == LOGLOG && (t.x[i] <= 0.0f || t.c[i][0] <= 0.0f)) return false;
+	}
+	return true;
+}
+
+bool Curve::set(const Table &t){
+	if(!valid(t)) return false;
+	_t = t;
+	if(_t.interp == LOGLOG){
+		for(uint8_t i = 0; i < _t.n; i++){ _lx[i] = log10f(_t.x[i]); _ly[i] = log10f(_t.c[i][0]); }
+	}
+	_custom = true;
+	return true;
+}
+
+// x[i] <= v 인 마지막 i (POLY: 0..n-1, 보간: 0..n-2 로 제한)
+uint8_t Curve::seg_(float v) const {
+	uint8_t lo = 0, hi = _t.n;           // upper_bound
+	while(lo < hi){
+		uint8_t mid = (lo + hi) >> 1;
+		if(_t.x[mid] <= v) lo = mid + 1; else hi = mid;
+	}
+	uint8_t i = lo ? lo - 1 : 0;
+	uint8_t last = (_t.interp == POLY) ? _t.n - 1 : _t.n - 2;
+	return i > last ? last : i;
+}
+
+float Curve::eval(float v) const {
+	if(isnan(v)) return NAN;
+	if(v <= _t.lo_x) return _t.lo_y;     // NAN 비교는 항상 false
+	if(v >= _t.hi_x) return _t.hi_y;
+
+	uint8_t i = seg_(v);
+	float y;
+	switch(_t.interp){
+		case POLY: {
+			const float *c = _t.c[i];
+			y = ((c[3] * v + c[2]) * v + c[1]) * v + c[0];
+			break;
+		}
+		case LINEAR: {
+			float x0 = _t.x[i], x1 = _t.x[i + 1];
+			float y0 = _t.c[i][0], y1 = _t.c[i + 1][0];
+			y = y0 + (y1 - y0) * (v - x0) / (x1 - x0);
+			break;
+		}
+		default: {
+			if(v <= 0.0f) return _t.y_max;   // log 정의역 밖 (Rs→0: 최대 농도 쪽)
+			float lv = log10f(v);
+			float ly = _ly[i] + (_ly[i + 1] - _ly[i]) * (lv - _lx[i]) / (_lx[i + 1] - _lx[i]);
+			y = powf(10.0f, ly);
+			break;
+		}
+	}
+	if(y < _t.y_min) y = _t.y_min;
+	if(y > _t.y_max) y = _t.y_max;
+	return y;
+}
+
+bool Curve::parse(const char* s, Table &out){
+	if(!s) return false;
+	Table t = {};
+	const char* p = s;
+	while(*p == ' ') p++;
+
+	uint8_t k = 0;
+	for(; k <= LOGLOG; k++){
+		size_t len = strlen(INTERP_NAMES[k]);
+		if(strncasecmp(p, INTERP_NAMES[k], len) == 0 && p[len] == ';'){ p += len + 1; break; }
+	}
+	if(k > LOGLOG) return false;
+	t.interp = k;
+
+	if(!parsePair_(p, t.lo_x, t.lo_y) || *p++ != ';') return false;
+	if(!parsePair_(p, t.hi_x, t.hi_y) || *p++ != ';') return false;
+	if(!parsePair_(p, t.y_min, t.y_max)) return false;
+
+	uint8_t nc = (t.interp == POLY) ? COEF_MAX : 1;
+	while(*p == ';'){
+		p++;
+		while(*p == ' ') p++;
+		if(!*p) break;                       // 끝의 ';' 허용
+		if(t.n >= SEG_MAX) return false;
+		char *end;
+		t.x[t.n] = strtof(p, &end);
+		if(end == p || *end != ':') return false;
+		p = end + 1;
+		for(uint8_t j = 0; j < nc; j++){
+			float c = strtof(p, &end);
+			if(end == p) break;
+			t.c[t.n][j] = c;
+			p = end;
+			if(*p != ',') break;
+			p++;
+		}
+		t.n++;
+		while(*p == ' ') p++;
+	}
+	if(*p) return false;
+	if(!valid(t)) return false;
+	out = t;
+	return true;
+}
+
+size_t Curve::format(char* out, size_t cap) const {
+	if(!cap) return 0;
+	size_t n = snprintf(out, cap, "%s;%.7g,%.7g;%.7g,%.7g;%.7g,%.7g",
+		INTERP_NAMES[_t.interp], _t.lo_x, _t.lo_y, _t.hi_x, _t.hi_y, _t.y_min, _t.y_max);
+	uint8_t nc = (_t.interp == POLY) ? COEF_MAX : 1;
+	for(uint8_t i = 0; i < _t.n && n < cap; i++){
+		// 뒤쪽 0 계수는 생략
+		uint8_t used = nc;
+		while(used > 1 && _t.c[i][used - 1] == 0.0f) used--;
+		n += snprintf(out + n, cap - n, ";%.7g:", _t.x[i]);
+		for(uint8_t j = 0; j < used && n < cap; j++)
+			n += snprintf(out + n, cap - n, j ? ",%.7g" : "%.7g", _t.c[i][j]);
+	}
+	if(n >= cap){ out[0] = '\0'; return 0; }
+	return n;
+}
+
+bool Curve::load(const char* key){
+	Preferences p;
+	if(!p.begin(NVS_NS, true)) return false;
+	Blob b;
+	bool ok = p.getBytesLength(key) == sizeof(b)
+	       && p.getBytes(key, &b, sizeof(b)) == sizeof(b)
+	       && b.magic == BLOB_MAGIC && b.ver == BLOB_VER;
+	p.end();
+	return ok && set(b.t);
+}
+
+bool Curve::save(const char* key, const Table &t){
+	if(!valid(t)) return false;
+	Preferences p;
+	if(!p.begin(NVS_NS, false)) return false;
+	Blob b = {};
+	b.magic = BLOB_MAGIC; b.ver = BLOB_VER; b.t = t;
+	bool ok = p.putBytes(key, &b, sizeof(b)) == sizeof(b);
+	p.end();
+	return ok;
+}
+
+void Curve::erase(const char* key){
+	Preferences p;
+	if(!p.begin(NVS_NS, false)) return;
+	p.remove(key);
+	p.end();
+}
+
+} // namespace cal
@@ -0,0 +1,107 @@
+// =============================
+// File: core/CalCurve.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// 아날로그 센서 교정 곡선 (구간 테이블 + 이진 탐색 + 다항식/선형 보간 + 클램프)
+// - 기본 테이블은 constexpr로 펌웨어에 포함되고, 장치별 테이블은 NVS("cal" 네임스페이스)에서 덮어씁니다.
+// - 포털에서는 텍스트 형식(parse/format)으로 주고받고, NVS에는 검증된 Table을 그대로 저장합니다.
+// - eval()은 sensorTask에서 호출되며, 테이블 교체(set/load)는 부팅 시에만 합니다. (잠금 없음)
+//   포털은 살아 있는 Curve를 건드리지 않고 parse()로 검증한 Table을 NVS에 저장(save)/삭제(erase)만 하고, 다음 부팅의 load()가 적용합니다.
+namespace cal {
+	static constexpr uint8_t SEG_MAX  = 8;    // 최대 구간(점) 수
+	static constexpr uint8_t COEF_MAX = 4;    // 구간당 다항식 계수 (최대 3차)
+
+	// Curve::format() 최악 길이 (NUL 포함). 숫자는 %.7g 최대 13자 ("-1.234568e-38")
+	//   "loglog" + 3 × ";a,b" + SEG_MAX × (";x:" + COEF_MAX개 계수와 쉼표)
+	static constexpr size_t NUM_TXT_MAX = 13;
+	static constexpr size_t FORMAT_MAX  = 6 + 3 * (2 + 2 * NUM_TXT_MAX)
+	                                    + SEG_MAX * (2 + NUM_TXT_MAX + COEF_MAX * (NUM_TXT_MAX + 1) - 1) + 1;
+
+	// POLY  : x[i] <= v < x[i+1] 구간에서 y = c[i][0] + c[i][1]*v + c[i][2]*v^2 + c[i][3]*v^3
+	//         (첫 구간 왼쪽/마지막 구간 오른쪽은 끝 구간 식을 그대로 연장)
+	// LINEAR: 점 (x[i], c[i][0]) 사이 선형 보간, 범위 밖은 끝 구간 기울기로 외삽
+	// LOGLOG: log10(x)-log10(y) 평면에서 선형 보간 (MQ 계열 데이터시트 곡선), x/y는 양수만
+	enum Interp : uint8_t { POLY = 0, LINEAR = 1, LOGLOG = 2 };
+
+	struct Table {
+		uint8_t interp;
+		uint8_t n;                   // 사용하는 구간(점) 수, x는 엄격히 오름차순
+		float   lo_x, lo_y;          // v <= lo_x 이면 lo_y (NAN이면 사용 안 함)
+		float   hi_x, hi_y;          // v >= hi_x 이면 hi_y (NAN이면 사용 안 함)
+		float   y_min, y_max;        // 결과 클램프
+		float   x[SEG_MAX];
+		float   c[SEG_MAX][COEF_MAX];
+	};
+
+	// GSET11-P110 CO 센서 (ADS1115 CH0 전압[V] → ppm), 4구간 2차식
+	//  1.00 ~ 1.82 V : 대략 0~100 ppm
+	//  1.82 ~ 2.18 V : 대략 110~220 ppm
+	//  2.18 ~ 2.61 V : 대략 230~400 ppm
+	//  2.61 ~ 3.55 V : 대략 450~1000 ppm
+	// 1.0 V 이하는 노이즈/오류로 보고 0 ppm
+	static constexpr Table GSET11_CO = {
+		POLY, 4,
+		1.0f, 0.0f,
+		NAN, 0.0f,
+		0.0f, 1000.0f,
+		{ 1.0f, 1.82f, 2.18f, 2.61f },
+		{
+			{  153.910337f, -303.866154f, 151.864662f, 0.0f },
+			{    2.772567f, -177.634899f, 127.987999f, 0.0f },
+			{  -26.303081f, -177.884252f, 134.327926f, 0.0f },
+			{ -439.821071f,  123.214449f,  79.481009f, 0.0f },
+		}
+	};
+
+	// MQ-2 연기 (Rs/R0 → ppm), 데이터시트 smoke 곡선
+	// 데이터시트 R0는 청정 공기 Rs/9.83 기준이므로 이 펌웨어의 R0(청정 공기 Rs)에 맞게 1/9.83 적용
+	// Rs/R0 >= 1 (청정 공기 이상)은 0 ppm
+	static constexpr Table MQ2_SMOKE = {
+		LOGLOG, 3,
+		NAN, 0.0f,
+		1.0f, 0.0f,
+		0.0f, 10000.0f,
+		{ 0.06158f, 0.16982f, 0.34470f },
+		{ { 10000.0f }, { 1000.0f }, { 200.0f } }
+	};
+
+	class Curve {
+		public:
+			explicit Curve(const Table &t){ reset(t); }
+
+			// 테이블 검증 후 적용. 잘못된 테이블이면 false, 기존 테이블 유지
+			bool set(const Table &t);
+			static bool valid(const Table &t);
+
+			float eval(float v) const;
+			float operator()(float v) const { return eval(v); }
+			const Table& table() const { return _t; }
+			bool custom() const { return _custom; }   // NVS/포털 테이블 사용 중
+
+			// 텍스트 형식 (포털 입력/표시용)
+			//   <poly|linear|loglog>;lo_x,lo_y;hi_x,hi_y;y_min,y_max;x0:c0,c1,..;x1:c0,c1,..;...
+			//   사용하지 않는 lo/hi는 nan
+			static bool parse(const char* s, Table &out);
+			// 길이(NUL 제외) 반환. cap이 모자라면 0 (잘린 텍스트는 다시 parse하면 다른 곡선이 되므로 내보내지 않음)
+			// cap >= FORMAT_MAX 이면 항상 성공
+			size_t format(char* out, size_t cap) const;
+
+			// NVS 저장/로드 (namespace "cal", key는 15자 이하)
+			// load(): 저장된 테이블이 없거나 손상되었으면 false, 현재(기본) 테이블 유지
+			// save(): 잘못된 테이블이면 저장하지 않고 false
+			bool load(const char* key);
+			static bool save(const char* key, const Table &t);
+			static void erase(const char* key);
+			void reset(const Table &def){ set(def); _custom = false; }
+
+		private:
+			uint8_t seg_(float v) const;
+
+			Table _t;
+			float _lx[SEG_MAX];          // LOGLOG용 log10 캐시
+			float _ly[SEG_MAX];
+			bool  _custom = false;
+	};
+} // namespace cal
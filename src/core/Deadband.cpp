@@ -0,0 +1,86 @@
+// =============================
+// File: core/Deadband.cpp
+// =============================
+#include "Deadband.h"
+#include "../config/BuildOpts.h"
+
+namespace telem {
+
+namespace {
+	constexpr uint16_t HB = RBE_HEARTBEAT_S;
+	constexpr Deadband::Policy ON_CHANGE = { 0.0f, 0.0f, HB };
+}
+
+// 필드 순서는 core/Telemetry.cpp의 FIELDS와 같음
+const Deadband::Policy Deadband::DEFAULT_POLICY[FIELD_COUNT] = {
+	{ 1.0f,  0.10f, HB },   // pm1_0 [ug/m3]
+	{ 1.0f,  0.10f, HB },   // pm2_5
+	{ 1.0f,  0.10f, HB },   // pm4_0
+	{ 1.0f,  0.10f, HB },   // pm10
+	{ 0.2f,  0.0f,  HB },   // temp [C]
+	{ 1.0f,  0.0f,  HB },   // hum [%RH]
+	{ 0.0f,  0.05f, HB },   // gas_kohm
+	{ 0.0f,  0.05f, HB },   // smk_blue
+	{ 0.0f,  0.05f, HB },   // smk_ir
+	{ 0.0f,  0.02f, HB },   // smk_ratio
+	{ 0.0f,  0.01f, HB },   // smk_alpha
+	{ 5.0f,  0.0f,  HB },   // smk_score
+	ON_CHANGE,              // smk_alarm (경보 중에는 force로 매 주기 발행)
+	{ 20.0f, 0.05f, HB },   // eCO2_ppm
+	{ 20.0f, 0.10f, HB },   // TVOC_ppb
+	{ 0.02f, 0.0f,  HB },   // CO_V
+	{ 2.0f,  0.05f, HB },   // CO_ppm
+	{ 20.0f, 0.0f,  HB },   // mq2_mV
+	{ 0.0f,  0.05f, HB },   // mq2_Rs
+	{ 0.02f, 0.0f,  HB },   // mq2_ratio
+	{ 0.02f, 0.0f,  HB },   // mq2_ema
+	{ 20.0f, 0.0f,  HB },   // Smoke_mV
+	{ 0.0f,  0.20f, HB },   // mic_rms
+	{ 1.0f,  0.0f,  HB },   // ZE07_CO_ppm
+	ON_CHANGE,              // gas_fp (배열: 스캔 완료 시에만 갱신되므로 항상 발행)
+	{ 5.0f,  0.10f, HB },   // mq2_ppm
+	{ 0.0f,  0.30f, HB },   // mic_peak
+	{ 1.0f,  0.0f,  HB },   // mic_laeq [dB]
+	{ 0.5f,  0.0f,  HB },   // mic_laeq_long [dB]
+	{ 0.0f,  0.20f, HB },   // awake_ms
+};
+
+bool Deadband::changed_(uint8_t i, float x) const {
+	float last = _last[i];
+	if(isnan(x) || isnan(last)) return isnan(x) != isnan(last);
+	const Policy &p = _pol[i];
+	float d = fabsf(x - last);
+	if(p.abs == 0.0f && p.rel == 0.0f) return d > 0.0f;
+	if(p.abs > 0.0f && d >= p.abs) return true;
+	if(p.rel > 0.0f && d >= p.rel * fabsf(last)) return true;
+	return false;
+}
+
+uint32_t Deadband::filter(const Sample &s, uint32_t now_ms, bool force){
+	uint32_t out = 0;
+	for(uint8_t i = 0; i < FIELD_COUNT; i++){
+		uint32_t bit = 1UL << i;
+		if(!(s.mask & bit)) continue;
+		_stats.fields_in++;
+
+		const Policy &p = _pol[i];
+		float x = s.asFloat((Field)i);     // 배열 필드는 NAN
+		bool send = force
+			|| !(_sent & bit)
+			|| FIELDS[i].kind == KIND_F32_VEC
+			|| (p.heartbeat_s && now_ms - _last_ms[i] >= p.heartbeat_s * 1000UL)
+			|| changed_(i, x);
+		if(!send) continue;
+
+		out |= bit;
+		_sent |= bit;
+		_last[i] = x;
+		_last_ms[i] = now_ms;
+		_stats.fields_out++;
+	}
+	_stats.samples++;
+	if(!out) _stats.suppressed++;
+	return out;
+}
+
+} // namespace telem
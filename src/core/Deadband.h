@@ -0,0 +1,53 @@
+// =============================
+// File: core/Deadband.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include "Telemetry.h"
+
+// 예외 보고(report-by-exception) 필터
+// - 필드마다 마지막으로 발행한 값과 시각을 기억하고, 값이 데드밴드를 벗어났거나
+//   하트비트(최대 침묵 시간)가 지난 필드만 발행 mask에 남깁니다.
+// - 데드밴드: |x - last| >= abs 또는 |x - last| >= rel * |last| (0인 항목은 사용 안 함)
+// - abs와 rel이 모두 0이면 값이 조금이라도 바뀔 때마다 발행 (경보 필드), 배열 필드는 갱신될 때마다 발행
+// - 경보 샘플은 filter(..., force=true)로 전체 필드를 발행합니다.
+// - 발행 잡(sensorTask)에서만 사용하며 내부 잠금은 없습니다.
+namespace telem {
+	class Deadband {
+		public:
+			struct Policy {
+				float    abs;           // 절대 변화량
+				float    rel;           // 상대 변화량 (직전 발행값 대비 비율)
+				uint16_t heartbeat_s;   // 변화가 없어도 이 간격마다 발행 (0이면 하트비트 없음)
+			};
+			static const Policy DEFAULT_POLICY[FIELD_COUNT];
+
+			struct Stats {
+				uint32_t samples = 0;       // filter() 호출 수
+				uint32_t suppressed = 0;    // 필드가 모두 걸러져 발행하지 않은 샘플 수
+				uint32_t fields_in = 0;     // 입력 필드 수 합계
+				uint32_t fields_out = 0;    // 발행한 필드 수 합계
+			};
+
+			Deadband(){ for(uint8_t i = 0; i < FIELD_COUNT; i++) _pol[i] = DEFAULT_POLICY[i]; }
+
+			void setPolicy(Field f, const Policy &p){ _pol[f] = p; }
+			const Policy& policy(Field f) const { return _pol[f]; }
+
+			// s.mask 중 발행할 필드만 남긴 mask를 반환하고, 남긴 필드의 값/시각을 기록
+			// force = true이면 모든 필드 발행 (경보 샘플)
+			uint32_t filter(const Sample &s, uint32_t now_ms, bool force=false);
+			// 다음 filter()에서 모든 필드를 한 번 발행
+			void reset(){ _sent = 0; }
+			const Stats& stats() const { return _stats; }
+
+		private:
+			bool changed_(uint8_t i, float x) const;
+
+			Policy   _pol[FIELD_COUNT];
+			float    _last[FIELD_COUNT];
+			uint32_t _last_ms[FIELD_COUNT];
+			uint32_t _sent = 0;             // 한 번이라도 발행한 필드 비트
+			Stats    _stats;
+	};
+} // namespace telem
@@ -0,0 +1,224 @@
+// =============================
+// File: core/Filters.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// 스트리밍 신호 필터 (헤더 전용, 동적 할당 없음)
+// - 윈도 크기 N과 값 타입 T는 컴파일 타임에 정합니다. (N은 작게: 정렬은 N^2 삽입 정렬)
+// - EmaFixed는 정수 연산만 사용하므로 ISR/고속 경로에서 써도 됩니다.
+// - 모든 필터는 단일 Task에서 사용한다고 가정하며 내부 잠금은 없습니다.
+// - 호스트 단위/벤치마크 테스트: host/test/test_filters.cpp
+namespace filt {
+
+	// T에 맞는 제곱근 (float이면 sqrtf, double 승격 없음)
+	inline float  sqrtT(float x){ return sqrtf(x); }
+	inline double sqrtT(double x){ return sqrt(x); }
+
+	// 배열 s[0..n-1]을 오름차순 정렬 (작은 n용 삽입 정렬)
+	template <class T>
+	inline void sortSmall(T* s, uint8_t n){
+		for(uint8_t i=1;i<n;i++){
+			T key = s[i]; int j = i - 1;
+			while(j >= 0 && s[j] > key){ s[j+1] = s[j]; j--; }
+			s[j+1] = key;
+		}
+	}
+
+	// s[0..n-1]의 양끝 trim개씩 버린 평균 (s는 정렬되어 바뀜). n==0이면 NAN
+	template <class T>
+	inline float trimmedMean(T* s, uint8_t n, uint8_t trim){
+		if(n == 0) return NAN;
+		if(2*trim >= n) trim = (n-1)/2;
+		sortSmall(s, n);
+		float sum = 0;
+		for(uint8_t i=trim;i<n-trim;i++) sum += (float)s[i];
+		return sum / (float)(n - 2*trim);
+	}
+
+	// 지수 이동 평균: y += a * (x - y). 첫 입력으로 초기화
+	template <class T = float>
+	class Ema {
+		public:
+			explicit Ema(T alpha = T(0.1)): _a(alpha) {}
+			void setAlpha(T a){ _a = a; }
+			T alpha() const { return _a; }
+			T update(T x){
+				_y = _ready ? _y + _a * (x - _y) : x;
+				_ready = true;
+				return _y;
+			}
+			void set(T y){ _y = y; _ready = true; }
+			void reset(){ _y = T(0); _ready = false; }
+			bool ready() const { return _ready; }
+			T value() const { return _y; }
+		private:
+			T    _a;
+			T    _y = T(0);
+			bool _ready = false;
+	};
+
+	// 고정소수점 EMA: alpha = 1/2^SHIFT, 내부 누산기는 입력 * 2^SHIFT (정수 연산만)
+	template <uint8_t SHIFT, class T = int32_t, class ACC = int64_t>
+	class EmaFixed {
+		public:
+			T update(T x){
+				if(!_ready){ _acc = (ACC)x * ((ACC)1 << SHIFT); _ready = true; }
+				else _acc += (ACC)x - (_acc >> SHIFT);
+				return value();
+			}
+			void reset(){ _acc = 0; _ready = false; }
+			bool ready() const { return _ready; }
+			T value() const { return (T)(_acc >> SHIFT); }
+		private:
+			ACC  _acc = 0;
+			bool _ready = false;
+	};
+
+	// 최근 N개 링 버퍼 (at(0) = 가장 오래된 값)
+	template <size_t N, class T>
+	class Window {
+		public:
+			static_assert(N > 0 && N <= 255, "window size 1..255");
+			void push(T x){
+				_buf[_head] = x;
+				_head = (_head + 1) % N;
+				if(_n < N) _n++;
+			}
+			uint8_t size() const { return _n; }
+			bool full() const { return _n == N; }
+			void reset(){ _head = 0; _n = 0; }
+			T at(uint8_t i) const { return _buf[(_head + N - _n + i) % N]; }
+			T last() const { return _buf[(_head + N - 1) % N]; }
+			// 최근 n개(최대 size())를 out에 복사, 복사한 개수 반환
+			uint8_t copyLast(T* out, uint8_t n) const {
+				if(n > _n) n = _n;
+				for(uint8_t i=0;i<n;i++) out[i] = _buf[(_head + N - n + i) % N];
+				return n;
+			}
+		private:
+			T       _buf[N];
+			uint8_t _head = 0;
+			uint8_t _n = 0;
+	};
+
+	// 윈도 중앙값
+	template <size_t N, class T = float>
+	class Median {
+		public:
+			T update(T x){ _w.push(x); return value(); }
+			T value() const {
+				T s[N]; uint8_t n = _w.copyLast(s, N);
+				if(n == 0) return T(0);
+				sortSmall(s, n);
+				return (n & 1) ? s[n/2] : (T)((s[n/2 - 1] + s[n/2]) / 2);
+			}
+			uint8_t size() const { return _w.size(); }
+			void reset(){ _w.reset(); }
+		private:
+			Window<N, T> _w;
+	};
+
+	// 윈도 절사 평균 (양끝 TRIM개씩 제외)
+	template <size_t N, uint8_t TRIM, class T = float>
+	class TrimmedMean {
+		public:
+			static_assert(2 * TRIM < N, "trim must leave at least one sample");
+			float update(T x){ _w.push(x); return value(); }
+			float value() const {
+				T s[N]; uint8_t n = _w.copyLast(s, N);
+				return trimmedMean(s, n, TRIM);
+			}
+			uint8_t size() const { return _w.size(); }
+			void reset(){ _w.reset(); }
+		private:
+			Window<N, T> _w;
+	};
+
+	// Hampel 이상치 제거: |x - median| > k * 1.4826 * MAD 이면 median으로 대체
+	template <size_t N, class T = float>
+	class Hampel {
+		public:
+			explicit Hampel(float k = 3.0f): _k(k) {}
+			// 필터된 값 반환. 입력이 이상치였으면 outlier()가 true
+			T update(T x){
+				T s[N]; uint8_t n = _w.copyLast(s, N);
+				_w.push(x);
+				_outlier = false;
+				if(n < 3) return x;       // 판단하기엔 표본이 적음
+				sortSmall(s, n);
+				float med = (n & 1) ? (float)s[n/2] : 0.5f * ((float)s[n/2 - 1] + (float)s[n/2]);
+				float d[N];
+				for(uint8_t i=0;i<n;i++) d[i] = fabsf((float)s[i] - med);
+				sortSmall(d, n);
+				float mad = (n & 1) ? d[n/2] : 0.5f * (d[n/2 - 1] + d[n/2]);
+				if(mad > 0.0f && fabsf((float)x - med) > _k * 1.4826f * mad){
+					_outlier = true;
+					_rejected++;
+					return (T)med;
+				}
+				return x;
+			}
+			bool outlier() const { return _outlier; }
+			uint32_t rejected() const { return _rejected; }
+			void reset(){ _w.reset(); _outlier = false; }
+		private:
+			Window<N, T> _w;
+			float    _k;
+			bool     _outlier = false;
+			uint32_t _rejected = 0;
+	};
+
+	// Welford 누적 평균/분산 (수치적으로 안정, 표본 수 제한 없음)
+	template <class T = float>
+	class Welford {
+		public:
+			void add(T x){
+				_n++;
+				T d = x - _mean;
+				_mean += d / (T)_n;
+				_m2 += d * (x - _mean);
+				if(_n == 1 || x < _lo) _lo = x;
+				if(_n == 1 || x > _hi) _hi = x;
+			}
+			uint32_t count() const { return _n; }
+			T mean() const { return _mean; }
+			T variance() const { return _n > 1 ? _m2 / (T)(_n - 1) : T(0); }   // 표본 분산
+			T stddev() const { return sqrtT(variance()); }
+			T lowest() const { return _lo; }
+			T highest() const { return _hi; }
+			void reset(){ _n = 0; _mean = T(0); _m2 = T(0); _lo = T(0); _hi = T(0); }
+		private:
+			uint32_t _n = 0;
+			T _mean = T(0), _m2 = T(0), _lo = T(0), _hi = T(0);
+	};
+
+	// 2차 IIR (Direct Form II Transposed), 계수는 a0 = 1로 정규화
+	// H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+	class Biquad {
+		public:
+			void set(float b0, float b1, float b2, float a1, float a2){
+				_b0 = b0; _b1 = b1; _b2 = b2; _a1 = a1; _a2 = a2;
+			}
+			void scale(float g){ _b0 *= g; _b1 *= g; _b2 *= g; }
+			float update(float x){
+				float y = _b0 * x + _z1;
+				_z1 = _b1 * x - _a1 * y + _z2;
+				_z2 = _b2 * x - _a2 * y;
+				return y;
+			}
+			void reset(){ _z1 = _z2 = 0.0f; }
+			// 주파수 f [Hz]에서의 크기 응답 |H| (fs = 샘플링 주파수)
+			float gainAt(float f, float fs) const {
+				float w = 2.0f * (float)M_PI * f / fs;
+				float c1 = cosf(w), s1 = sinf(w), c2 = cosf(2*w), s2 = sinf(2*w);
+				float nr = _b0 + _b1*c1 + _b2*c2, ni = -(_b1*s1 + _b2*s2);
+				float dr = 1.0f + _a1*c1 + _a2*c2, di = -(_a1*s1 + _a2*s2);
+				return sqrtf((nr*nr + ni*ni) / (dr*dr + di*di));
+			}
+		private:
+			float _b0 = 1.0f, _b1 = 0.0f, _b2 = 0.0f, _a1 = 0.0f, _a2 = 0.0f;
+			float _z1 = 0.0f, _z2 = 0.0f;
+	};
+
+} // namespace filt
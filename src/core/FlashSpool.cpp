@@ -0,0 +1,242 @@
+// =============================
+// File: core/FlashSpool.cpp
+// =============================
+#include "FlashSpool.h"
+
+namespace {
+	constexpr uint16_t REC_MAGIC = 0x5053; // "SP"
+	constexpr uint32_t REC_OVERHEAD = sizeof(uint16_t) + sizeof(FlashSpool::RecHdr);
+	static_assert(sizeof(FlashSpool::RecHdr) == 16, "on-flash record header layout");
+}
+
+void FlashSpool::segPath_(uint32_t id, char* out, size_t cap) const {
+	snprintf(out, cap, "%s/%08lu.log", _dir, (unsigned long)id);
+}
+
+uint32_t FlashSpool::segSize_(uint32_t id) const {
+	char path[40]; segPath_(id, path, sizeof(path));
+	File f = _fs->open(path, FILE_READ);
+	if(!f) return 0;
+	uint32_t n = f.size();
+	f.close();
+	return n;
+}
+
+bool FlashSpool::begin(FS &fs, const char* dir, uint32_t seg_bytes, uint8_t max_segs){
+	_fs = &fs;
+	strncpy(_dir, dir, sizeof(_dir) - 1);
+	_seg_bytes = seg_bytes;
+	_max_segs = max_segs < 2 ? 2 : max_segs;
+
+	_fs->mkdir(_dir);
+	File root = _fs->open(_dir);
+	if(!root || !root.isDirectory()){ _fs = nullptr; return false; }
+
+	// 기존 세그먼트 id 범위 확인
+	bool any = false;
+	uint32_t lo = 0, hi = 0;
+	for(File f = root.openNextFile(); f; f = root.openNextFile()){
+		const char* name = strrchr(f.name(), '/');
+		name = name ? name + 1 : f.name();
+		char *end = nullptr;
+		uint32_t id = strtoul(name, &end, 10);
+		if(end && strcmp(end, ".log") == 0){
+			if(!any || id < lo) lo = id;
+			if(!any || id > hi) hi = id;
+			any = true;
+		}
+		f.close();
+	}
+	root.close();
+
+	_head_seg = any ? lo : 1;
+	_tail_seg = any ? hi : 1;
+	_tail_size = any ? segSize_(_tail_seg) : 0;
+
+	// 기록 중 전원이 끊겨 마지막 레코드가 잘렸으면 그 뒤에 이어 쓰지 않고 새 세그먼트부터 기록
+	// (잘린 부분은 재전송 시 peek()에서 건너뜀)
+	if(_tail_size > 0 && validEnd_(_tail_seg) != _tail_size){
+		_tail_seg++; _tail_size = 0;
+	}
+
+	loadCursor_();
+	if(_cur_seg < _head_seg || _cur_seg > _tail_seg){ _cur_seg = _head_seg; _cur_off = 0; }
+
+	_bytes_pending = 0;
+	for(uint32_t id = _cur_seg; id <= _tail_seg; id++){
+		uint32_t sz = (id == _tail_seg) ? _tail_size : segSize_(id);
+		_bytes_pending += (id == _cur_seg) ? (sz > _cur_off ? sz - _cur_off : 0) : sz;
+	}
+	_peek_n = 0;
+	return true;
+}
+
+uint32_t FlashSpool::validEnd_(uint32_t id) const {
+	char path[40]; segPath_(id, path, sizeof(path));
+	File f = _fs->open(path, FILE_READ);
+	if(!f) return 0;
+	uint32_t sz = f.size(), off = 0;
+	while(off + REC_OVERHEAD <= sz){
+		uint16_t magic = 0; RecHdr h;
+		if(f.read((uint8_t*)&magic, sizeof(magic)) != sizeof(magic) || magic != REC_MAGIC) break;
+		if(f.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) break;
+		if(off + REC_OVERHEAD + h.len > sz) break;
+		off += REC_OVERHEAD + h.len;
+		f.seek(off);
+	}
+	f.close();
+	return off;
+}
+
+void FlashSpool::loadCursor_(){
+	char path[40]; snprintf(path, sizeof(path), "%s/cursor", _dir);
+	_cur_seg = 0; _cur_off = 0;
+	File f = _fs->open(path, FILE_READ);
+	if(!f) return;
+	uint32_t v[2];
+	if(f.read((uint8_t*)v, sizeof(v)) == sizeof(v)){ _cur_seg = v[0]; _cur_off = v[1]; }
+	f.close();
+}
+
+void FlashSpool::saveCursor_(){
+	char path[40]; snprintf(path, sizeof(path), "%s/cursor", _dir);
+	File f = _fs->open(path, FILE_WRITE);
+	if(!f) return;
+	uint32_t v[2] = { _cur_seg, _cur_off };
+	f.write((const uint8_t*)v, sizeof(v));
+	f.close();
+	_cur_unsaved = 0;
+}
+
+void FlashSpool::dropOldest_(){
+	char path[40]; segPath_(_head_seg, path, sizeof(path));
+	uint32_t sz = segSize_(_head_seg);
+	_fs->remove(path);
+
+	if(_cur_seg == _head_seg){
+		_bytes_pending -= (sz > _cur_off) ? sz - _cur_off : 0;
+		_cur_seg = _head_seg + 1; _cur_off = 0;
+		saveCursor_();
+	}
+	_head_seg++;
+	_dropped++;
+	_peek_n = 0;
+}
+
+bool FlashSpool::append(const RecHdr &h, const void* data){
+	if(!_fs) return false;
+	uint32_t rec = REC_OVERHEAD + h.len;
+
+	if(_tail_size > 0 && _tail_size + rec > _seg_bytes){
+		_tail_seg++; _tail_size = 0;
+		while(_tail_seg - _head_seg + 1 > _max_segs) dropOldest_();
+	}
+
+	char path[40]; segPath_(_tail_seg, path, sizeof(path));
+	File f = _fs->open(path, FILE_APPEND, true);
+	if(!f) return false;
+	uint16_t magic = REC_MAGIC;
+	bool ok = f.write((const uint8_t*)&magic, sizeof(magic)) == sizeof(magic)
+	       && f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h)
+	       && f.write((const uint8_t*)data, h.len) == h.len;
+	f.close();
+	if(!ok) return false;
+
+	_tail_size += rec;
+	_bytes_pending += rec;
+	return true;
+}
+
+bool FlashSpool::empty(){
+	return _bytes_pending == 0;
+}
+
+uint8_t FlashSpool::peek(RecHdr* hdrs, uint8_t max){
+	_peek_n = 0;
+	if(!_fs || empty()) return 0;
+	if(max > PEEK_MAX) max = PEEK_MAX;
+
+	for(;;){
+		uint32_t sz = (_cur_seg == _tail_seg) ? _tail_size : segSize_(_cur_seg);
+		if(_cur_off >= sz){
+			if(_cur_seg >= _tail_seg) return 0;
+			// 재전송이 끝난 세그먼트는 삭제하고 다음 세그먼트로
+			consume(0);
+			continue;
+		}
+
+		char path[40]; segPath_(_cur_seg, path, sizeof(path));
+		File f = _fs->open(path, FILE_READ);
+		if(!f) return 0;
+		f.seek(_cur_off);
+
+		uint32_t off = _cur_off;
+		while(_peek_n < max && off + REC_OVERHEAD <= sz){
+			uint16_t magic = 0; RecHdr h;
+			if(f.read((uint8_t*)&magic, sizeof(magic)) != sizeof(magic) || magic != REC_MAGIC) break;
+			if(f.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) break;
+			if(off + REC_OVERHEAD + h.len > sz) break;
+			if(_peek_n > 0 && h.tag != hdrs[0].tag) break;
+
+			hdrs[_peek_n] = h;
+			_peek_off[_peek_n] = off;
+			_peek_len[_peek_n] = h.len;
+			_peek_n++;
+			off += REC_OVERHEAD + h.len;
+			f.seek(off);
+		}
+		f.close();
+
+		if(_peek_n == 0){
+			// 손상된(중간에 끊긴) 레코드: 세그먼트 나머지를 건너뜀 (커서는 다음 세그먼트로 넘어갈 때 저장)
+			_bytes_pending -= sz - _cur_off;
+			_cur_off = sz;
+			if(_cur_seg >= _tail_seg) return 0;
+			continue;
+		}
+		_peek_seg = _cur_seg;
+		_peek_end = off;
+		return _peek_n;
+	}
+}
+
+bool FlashSpool::readPayload(uint8_t idx, void* buf, size_t cap){
+	if(idx >= _peek_n || _peek_len[idx] > cap) return false;
+	char path[40]; segPath_(_peek_seg, path, sizeof(path));
+	File f = _fs->open(path, FILE_READ);
+	if(!f) return false;
+	f.seek(_peek_off[idx] + REC_OVERHEAD);
+	bool ok = f.read((uint8_t*)buf, _peek_len[idx]) == _peek_len[idx];
+	f.close();
+	return ok;
+}
+
+void FlashSpool::consume(uint8_t n){
+	if(n > 0 && _peek_n > 0 && _peek_seg == _cur_seg){
+		if(n > _peek_n) n = _peek_n;
+		uint32_t new_off = (n < _peek_n) ? _peek_off[n] : _peek_end;
+		_bytes_pending -= new_off - _cur_off;
+		_cur_off = new_off;
+		_cur_unsaved = (_cur_unsaved + n > 255) ? 255 : _cur_unsaved + n;
+	}
+	_peek_n = 0;
+
+	uint32_t sz = (_cur_seg == _tail_seg) ? _tail_size : segSize_(_cur_seg);
+	if(_cur_off >= sz){
+		char path[40]; segPath_(_cur_seg, path, sizeof(path));
+		if(_cur_seg < _tail_seg){
+			// 다 보낸 세그먼트 삭제
+			_fs->remove(path);
+			_head_seg = ++_cur_seg;
+			_cur_off = 0;
+			saveCursor_();
+		} else if(_cur_off > 0){
+			// 모두 재전송 완료: 현재 세그먼트를 비우고 새 세그먼트부터 다시 기록
+			_fs->remove(path);
+			_head_seg = _tail_seg = ++_cur_seg;
+			_tail_size = 0; _cur_off = 0;
+			saveCursor_();
+		}
+	}
+	if(_cur_unsaved >= CURSOR_SAVE_EVERY) saveCursor_();
+}
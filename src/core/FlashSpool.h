@@ -0,0 +1,74 @@
+// =============================
+// File: core/FlashSpool.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+// LittleFS 기반 append-only 링 로그 (MQTT/Wi-Fi 단절 중 텔레메트리 보관용)
+// - 레코드는 세그먼트 파일(<dir>/<id>.log)에 뒤로만 추가됩니다.
+// - 세그먼트가 seg_bytes를 넘으면 다음 id로 넘어가고, max_segs를 넘으면 가장 오래된 세그먼트를 지웁니다.
+// - 재전송 커서(세그먼트 id + 오프셋)는 <dir>/cursor에 저장되어 재부팅 후에도 이어집니다.
+//   플래시 쓰기를 줄이려고 세그먼트 경계(다 보낸 세그먼트 삭제/비움)와 CURSOR_SAVE_EVERY 레코드마다만
+//   저장하므로, 그 사이에 전원이 끊기면 마지막 저장 이후 레코드가 다시 전송됩니다.
+//   (레코드마다 ts/boot_id/uptime_s가 있어 수신 측에서 중복을 가려낼 수 있음)
+// - 사용 흐름: append() ... peek() → readPayload() → consume(n)
+// - 단일 Task(mqttTask)에서만 사용한다고 가정하며 내부 잠금은 없습니다.
+class FlashSpool {
+	public:
+		struct RecHdr {
+			uint16_t len = 0;       // 페이로드 길이
+			uint8_t  tag = 0;       // 발행 구분값 (MsgPool::Msg::tag)
+			uint8_t  flags = 0;
+			uint32_t ts = 0;        // epoch 초 (기록 시 시계 미동기면 0)
+			uint32_t uptime_s = 0;  // 기록 시 부팅 후 경과 초
+			uint32_t boot_id = 0;   // 기록한 부팅 세션 식별자
+		};
+		static constexpr uint8_t PEEK_MAX = 32;
+		static constexpr uint8_t CURSOR_SAVE_EVERY = 64;   // 세그먼트 내 커서 저장 간격 (레코드 수)
+
+		bool begin(FS &fs, const char* dir="/spool", uint32_t seg_bytes=64*1024, uint8_t max_segs=16);
+		bool ready() const { return _fs != nullptr; }
+
+		bool append(const RecHdr &h, const void* data);
+
+		// 커서 위치부터 tag가 같은 연속 레코드 헤더를 최대 max개 읽습니다.
+		uint8_t peek(RecHdr* hdrs, uint8_t max);
+		// peek()로 읽은 idx번째 레코드의 페이로드 읽기
+		bool readPayload(uint8_t idx, void* buf, size_t cap);
+		// peek()로 읽은 레코드 중 앞의 n개를 재전송 완료 처리
+		void consume(uint8_t n);
+
+		bool empty();
+		uint32_t bytesPending() const { return _bytes_pending; }
+		uint32_t dropped() const { return _dropped; }   // 용량 초과로 버려진 세그먼트 수
+
+	private:
+		void segPath_(uint32_t id, char* out, size_t cap) const;
+		void dropOldest_();
+		void saveCursor_();
+		void loadCursor_();
+		uint32_t segSize_(uint32_t id) const;
+		uint32_t validEnd_(uint32_t id) const;
+
+		FS*      _fs = nullptr;
+		char     _dir[24] = {0};
+		uint32_t _seg_bytes = 0;
+		uint8_t  _max_segs = 0;
+
+		uint32_t _head_seg = 0;     // 가장 오래된 세그먼트
+		uint32_t _tail_seg = 0;     // 쓰는 중인 세그먼트
+		uint32_t _tail_size = 0;
+		uint32_t _cur_seg = 0;      // 재전송 커서
+		uint32_t _cur_off = 0;
+		uint8_t  _cur_unsaved = 0;  // 마지막 커서 저장 이후 consume한 레코드 수
+		uint32_t _bytes_pending = 0;
+		uint32_t _dropped = 0;
+
+		// peek 결과 (세그먼트 내 오프셋)
+		uint8_t  _peek_n = 0;
+		uint32_t _peek_seg = 0;
+		uint32_t _peek_off[PEEK_MAX];
+		uint32_t _peek_end = 0;
+		uint16_t _peek_len[PEEK_MAX];
+};
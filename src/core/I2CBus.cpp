@@ -0,0 +1,53 @@
+// =============================
+// File: core/I2CBus.cpp
+// =============================
+#include "I2CBus.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace i2cbus {
+
+namespace {
+	TwoWire*          s_wire = &Wire;
+	SemaphoreHandle_t s_lock = nullptr;
+	uint8_t           s_depth = 0;     // 점유 Task 안에서의 Guard 중첩 깊이 (점유 Task만 접근)
+	Stats             s_stats;
+}
+
+bool begin(TwoWire &w, int sda, int scl, uint32_t default_hz){
+	s_wire = &w;
+	if(!s_lock) s_lock = xSemaphoreCreateRecursiveMutex();
+	s_stats.hz = default_hz;
+	return s_wire->begin(sda, scl, default_hz) && s_lock != nullptr;
+}
+
+TwoWire& wire(){ return *s_wire; }
+
+Guard::Guard(uint32_t hz){
+	if(!s_lock) return;
+	if(xSemaphoreTakeRecursive(s_lock, 0) != pdTRUE){
+		uint32_t t0 = micros();
+		xSemaphoreTakeRecursive(s_lock, portMAX_DELAY);
+		uint32_t waited = micros() - t0;
+		s_stats.contended++;
+		if(waited > s_stats.max_wait_us) s_stats.max_wait_us = waited;
+	}
+	if(s_depth++ == 0){
+		s_stats.transactions++;
+		if(hz && hz != s_stats.hz){
+			s_wire->setClock(hz);
+			s_stats.hz = hz;
+			s_stats.clock_switches++;
+		}
+	}
+}
+
+Guard::~Guard(){
+	if(!s_lock) return;
+	s_depth--;
+	xSemaphoreGiveRecursive(s_lock);
+}
+
+Stats stats(){ return s_stats; }
+
+} // namespace i2cbus
@@ -0,0 +1,34 @@
+// =============================
+// File: core/I2CBus.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+#include "../config/BuildOpts.h"
+
+// 공유 I2C 버스 관리자
+// - sensorTask, ADS1115/SMOKE2 백그라운드 Task, 설정 포털 핸들러 등 여러 Task가 같은 Wire를 쓰므로
+//   드라이버는 I2C 접근 구간을 i2cbus::Guard로 감쌉니다. (재귀 뮤텍스 → 중첩 가능)
+// - 대기 Task는 FreeRTOS 뮤텍스 대기열에서 우선순위 순으로 차례를 받습니다.
+// - Guard에 클럭을 지정하면 가장 바깥 Guard에서만 필요할 때 Wire.setClock()으로 전환합니다.
+namespace i2cbus {
+	bool begin(TwoWire &w, int sda, int scl, uint32_t default_hz);
+	TwoWire& wire();
+
+	class Guard {
+		public:
+			explicit Guard(uint32_t hz=0);
+			~Guard();
+			Guard(const Guard&) = delete;
+			Guard& operator=(const Guard&) = delete;
+	};
+
+	struct Stats {
+		uint32_t transactions = 0;    // 바깥 Guard 획득 횟수
+		uint32_t contended = 0;       // 다른 Task가 점유 중이어서 기다린 횟수
+		uint32_t max_wait_us = 0;     // 최대 대기 시간
+		uint32_t clock_switches = 0;  // Wire.setClock() 호출 횟수
+		uint32_t hz = 0;              // 현재 클럭
+	};
+	Stats stats();
+} // namespace i2cbus
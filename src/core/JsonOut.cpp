@@ -0,0 +1,80 @@
+// =============================
+// File: core/JsonOut.cpp
+// =============================
+#include "JsonOut.h"
+
+namespace {
+    const uint32_t kPow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    constexpr uint8_t kMaxDigits = 6;
+}
+
+size_t JsonBuf::finish(){
+    puts_(" }");
+    if(_cap) _buf[_len < _cap ? _len : _cap - 1] = '\0';
+    return _ovf ? 0 : _len;
+}
+
+void JsonBuf::putU_(uint32_t v){
+    char tmp[10]; uint8_t n = 0;
+    do { tmp[n++] = char('0' + v % 10); v /= 10; } while(v);
+    while(n) put_(tmp[--n]);
+}
+
+void JsonBuf::putU64_(uint64_t v){
+    char tmp[20]; uint8_t n = 0;
+    do { tmp[n++] = char('0' + v % 10); v /= 10; } while(v);
+    while(n) put_(tmp[--n]);
+}
+
+// JSON 문자열 이스케이프: 따옴표/역슬래시 앞에 역슬래시, 제어문자는 유니코드 이스케이프
+void JsonBuf::putEsc_(const char* s){
+    static const char kHex[] = "0123456789abcdef";
+    for(; *s; s++){
+        uint8_t c = (uint8_t)*s;
+        if(c == '"' || c == '\\'){ put_('\\'); put_((char)c); }
+        else if(c < 0x20){ puts_("\\u00"); put_(kHex[c >> 4]); put_(kHex[c & 0xF]); }
+        else put_((char)c);
+    }
+}
+
+// Print::print(float, digits)와 같은 반올림 결과를 정수 연산으로 출력
+// float = m × 2^e (m: 24비트 정수)로 분해해 m × 10^digits를 2^-e로 반올림 나눗셈 (double 연산 없음)
+void JsonBuf::putF_(float v, uint8_t digits){
+    if(!isfinite(v)){ puts_("null"); return; }
+    if(digits > kMaxDigits) digits = kMaxDigits;
+
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const bool neg = bits >> 31;
+    int32_t  e = (int32_t)((bits >> 23) & 0xFF);
+    uint32_t m = bits & 0x7FFFFF;
+    if(e) m |= 0x800000; else e = 1;  // 비정규수는 암묵 비트 없음
+    e -= 150;                          // 지수 바이어스 127 + 가수 23비트
+
+    if(e > 8){ // 정수부가 2^32 이상인 값은 드물므로 지수 표기로 대체
+        char tmp[24];
+        snprintf(tmp, sizeof(tmp), "%.*e", digits, (double)v);
+        puts_(tmp);
+        return;
+    }
+
+    const uint32_t scale = kPow10[digits];
+    uint64_t fixed;
+    if(e >= 0) fixed = (uint64_t)(m << e) * scale;
+    else {
+        const uint32_t sh = (uint32_t)-e;
+        const uint64_t x = (uint64_t)m * scale;            // < 2^44
+        fixed = (sh < 46) ? (x + (1ull << (sh - 1))) >> sh : 0;
+    }
+    if(neg && fixed) put_('-');
+
+    putU64_(fixed / scale);
+    if(digits){
+        put_('.');
+        uint32_t frac = (uint32_t)(fixed % scale);
+        for(uint8_t d = digits; d > 0; d--){
+            uint32_t p = kPow10[d - 1];
+            put_(char('0' + (frac / p) % 10));
+        }
+    }
+}
@@ -3,17 +3,47 @@
 // =============================
 #pragma once
 #include <Arduino.h>
+// 호출자가 제공한 고정 버퍼에 직접 쓰는 JSON writer (힙 할당/중간 복사 없음)
+// - float은 고정소수점 정수 변환으로 출력합니다. (NaN/Inf는 null, 정수부 2^32 이상만 snprintf 지수 표기)
+// - 키는 이스케이프하지 않으므로 문자열 리터럴만 넘깁니다. 문자열 값(addS)은 이스케이프합니다.
+// - 버퍼가 부족하면 overflow()가 true가 되고 이후 쓰기는 무시됩니다.
+// - finish()로 " }"와 NUL을 붙여 닫고 길이를 반환합니다. (overflow 시 0)
+class JsonBuf {
+    public:
+        JsonBuf(char *buf, size_t cap): _buf(buf), _cap(cap) { puts_("{ "); }
+        void add(const char* k, float v, uint8_t digits=2){ key(k); putF_(v, digits); }
+        void addU(const char* k, uint32_t v){ key(k); putU_(v); }
+        void addS(const char* k, const char* v){ key(k); put_('"'); putEsc_(v); put_('"'); }
+        void addArr(const char* k, const float* v, uint8_t n, uint8_t digits=2){
+            key(k); put_('[');
+            for(uint8_t i=0;i<n;i++){ if(i) put_(','); putF_(v[i], digits); }
+            put_(']');
+        }
+        void addArrU(const char* k, const uint32_t* v, uint8_t n){
+            key(k); put_('[');
+            for(uint8_t i=0;i<n;i++){ if(i) put_(','); putU_(v[i]); }
+            put_(']');
+        }
+        // 중첩 객체: beginObj(key) ... endObj()
+        void beginObj(const char* k){ key(k); put_('{'); _first=true; }
+        void endObj(){ put_('}'); _first=false; }
+        size_t finish();
 
+        size_t remaining() const { return _cap > _len ? _cap - _len : 0; }
+        bool overflow() const { return _ovf; }
 
-class JsonOut {
-    public:
-        JsonOut(Stream &s): _s(s), _first(true) { _s.print("{ "); }
-        ~JsonOut(){ _s.println(" }"); }
-        void add(const char* k, float v, uint8_t digits=2){ key(k); _s.print(v, digits);}
-        void addU(const char* k, uint32_t v){ key(k); _s.print(v);}
-        void addS(const char* k, const char* v){ key(k); _s.print('"'); _s.print(v); _s.print('"');}
-    
     private:
-        void key(const char* k){ if(!_first) _s.print(","); _first=false; _s.print('"'); _s.print(k); _s.print('"'); _s.print(":"); }
-        Stream &_s; bool _first;
-};
\ No newline at end of file
+        void key(const char* k){ if(!_first) put_(','); _first=false; put_('"'); puts_(k); put_('"'); put_(':'); }
+        void put_(char c){ if(_len + 1 < _cap) _buf[_len++] = c; else _ovf = true; } // NUL 자리 1바이트 예약
+        void puts_(const char* s){ while(*s) put_(*s++); }
+        void putEsc_(const char* s);
+        void putU_(uint32_t v);
+        void putU64_(uint64_t v);
+        void putF_(float v, uint8_t digits);
+
+        char  *_buf;
+        size_t _cap;
+        size_t _len = 0;
+        bool   _first = true;
+        bool   _ovf = false;
+};
@@ -0,0 +1,175 @@
+// =============================
+// File: core/Metrics.cpp
+// =============================
+#include "Metrics.h"
+#include "Scheduler.h"
+#include "I2CBus.h"
+
+namespace metrics {
+
+// 1-2-5 간격 (50us ~ 100ms), 그 이상은 +Inf
+const uint32_t BUCKET_LE_US[BUCKETS - 1] = {
+	50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000
+};
+
+namespace {
+	Hist g_hist[prof::SLOT_COUNT];
+
+	struct TaskEnt { const char* name; TaskHandle_t h; };
+	TaskEnt  g_tasks[MAX_TASKS];
+	uint8_t  g_ntasks = 0;
+
+	struct GaugeEnt { const char* name; GaugeFn fn; uint32_t max; };
+	GaugeEnt g_gauges[MAX_GAUGES];
+	uint8_t  g_ngauges = 0;
+
+	const Scheduler* g_sched = nullptr;
+
+	constexpr size_t HIST_JSON_MAX = 224;    // 최악의 경우 "slot":{"n":..,"max":..,"sum_ms":..,"h":[12개]} + 닫는 괄호들
+
+	// 단편화(%) = 가장 큰 블록이 여유 힙에서 차지하지 못하는 비율
+	uint32_t fragPct(uint32_t free_b, uint32_t max_b){
+		return free_b ? 100 - (uint32_t)((uint64_t)max_b * 100 / free_b) : 0;
+	}
+} // anonymous namespace
+
+void record(prof::Slot s, uint32_t us){
+	if(s >= prof::SLOT_COUNT) return;
+	Hist &h = g_hist[s];
+	uint8_t i = 0;
+	while(i < BUCKETS - 1 && us > BUCKET_LE_US[i]) i++;
+	h.b[i]++;
+	h.n++;
+	h.sum_us += us;
+	if(us > h.max_us) h.max_us = us;
+}
+
+const Hist& hist(prof::Slot s){ return g_hist[s]; }
+
+void addTask(const char* name, TaskHandle_t h){
+	if(!h || g_ntasks >= MAX_TASKS) return;
+	g_tasks[g_ntasks++] = { name, h };
+}
+
+void addGauge(const char* name, GaugeFn fn){
+	if(!fn || g_ngauges >= MAX_GAUGES) return;
+	g_gauges[g_ngauges++] = { name, fn, 0 };
+}
+
+void setScheduler(const Scheduler* s){ g_sched = s; }
+
+void sample(){
+	for(uint8_t i = 0; i < g_ngauges; i++){
+		uint32_t v = g_gauges[i].fn();
+		if(v > g_gauges[i].max) g_gauges[i].max = v;
+	}
+}
+
+void writeText(Print &o){
+	o.printf("# TYPE sensorhub_uptime_seconds gauge\nsensorhub_uptime_seconds %lu\n", (unsigned long)(millis() / 1000));
+
+	uint32_t free_b = ESP.getFreeHeap(), max_b = ESP.getMaxAllocHeap();
+	o.printf("# TYPE sensorhub_heap_free_bytes gauge\nsensorhub_heap_free_bytes %lu\n", (unsigned long)free_b);
+	o.printf("# TYPE sensorhub_heap_min_free_bytes gauge\nsensorhub_heap_min_free_bytes %lu\n", (unsigned long)ESP.getMinFreeHeap());
+	o.printf("# TYPE sensorhub_heap_max_alloc_bytes gauge\nsensorhub_heap_max_alloc_bytes %lu\n", (unsigned long)max_b);
+	o.printf("# TYPE sensorhub_heap_frag_percent gauge\nsensorhub_heap_frag_percent %lu\n", (unsigned long)fragPct(free_b, max_b));
+
+	// ESP-IDF의 uxTaskGetStackHighWaterMark()는 바이트 단위
+	o.printf("# TYPE sensorhub_task_stack_free_min_bytes gauge\n");
+	for(uint8_t i = 0; i < g_ntasks; i++)
+		o.printf("sensorhub_task_stack_free_min_bytes{task=\"%s\"} %u\n", g_tasks[i].name, (unsigned)uxTaskGetStackHighWaterMark(g_tasks[i].h));
+
+	o.printf("# TYPE sensorhub_gauge gauge\n# TYPE sensorhub_gauge_max gauge\n");
+	for(uint8_t i = 0; i < g_ngauges; i++){
+		o.printf("sensorhub_gauge{name=\"%s\"} %lu\n", g_gauges[i].name, (unsigned long)g_gauges[i].fn());
+		o.printf("sensorhub_gauge_max{name=\"%s\"} %lu\n", g_gauges[i].name, (unsigned long)g_gauges[i].max);
+	}
+
+	i2cbus::Stats is = i2cbus::stats();
+	o.printf("# TYPE sensorhub_i2c_transactions_total counter\nsensorhub_i2c_transactions_total %lu\n", (unsigned long)is.transactions);
+	o.printf("# TYPE sensorhub_i2c_contended_total counter\nsensorhub_i2c_contended_total %lu\n", (unsigned long)is.contended);
+	o.printf("# TYPE sensorhub_i2c_max_wait_us gauge\nsensorhub_i2c_max_wait_us %lu\n", (unsigned long)is.max_wait_us);
+
+	if(g_sched){
+		o.printf("# TYPE sensorhub_job_runs_total counter\n# TYPE sensorhub_job_overruns_total counter\n# TYPE sensorhub_job_late_max_ms gauge\n");
+		for(uint8_t i = 0; i < g_sched->count(); i++){
+			const Scheduler::Job &j = g_sched->job(i);
+			o.printf("sensorhub_job_runs_total{job=\"%s\"} %lu\n", j.name, (unsigned long)j.runs);
+			o.printf("sensorhub_job_overruns_total{job=\"%s\"} %lu\n", j.name, (unsigned long)j.overruns);
+			o.printf("sensorhub_job_late_max_ms{job=\"%s\"} %lu\n", j.name, (unsigned long)j.late_max_ms);
+		}
+	}
+
+	// Prometheus 히스토그램 버킷은 누적
+	o.printf("# TYPE sensorhub_latency_us histogram\n# TYPE sensorhub_latency_max_us gauge\n");
+	for(uint8_t s = 0; s < prof::SLOT_COUNT; s++){
+		const Hist &h = g_hist[s];
+		if(!h.n) continue;
+		const char* nm = prof::name((prof::Slot)s);
+		uint32_t acc = 0;
+		for(uint8_t i = 0; i < BUCKETS - 1; i++){
+			acc += h.b[i];
+			o.printf("sensorhub_latency_us_bucket{slot=\"%s\",le=\"%lu\"} %lu\n", nm, (unsigned long)BUCKET_LE_US[i], (unsigned long)acc);
+		}
+		o.printf("sensorhub_latency_us_bucket{slot=\"%s\",le=\"+Inf\"} %lu\n", nm, (unsigned long)h.n);
+		o.printf("sensorhub_latency_us_sum{slot=\"%s\"} %llu\n", nm, (unsigned long long)h.sum_us);
+		o.printf("sensorhub_latency_us_count{slot=\"%s\"} %lu\n", nm, (unsigned long)h.n);
+		o.printf("sensorhub_latency_max_us{slot=\"%s\"} %lu\n", nm, (unsigned long)h.max_us);
+	}
+}
+
+void writeSystem(JsonBuf &js){
+	uint32_t free_b = ESP.getFreeHeap(), max_b = ESP.getMaxAllocHeap();
+	js.beginObj("heap");
+	js.addU("free", free_b);
+	js.addU("min_free", ESP.getMinFreeHeap());
+	js.addU("max_alloc", max_b);
+	js.addU("frag_pct", fragPct(free_b, max_b));
+	js.endObj();
+
+	js.beginObj("stack_free");
+	for(uint8_t i = 0; i < g_ntasks; i++) js.addU(g_tasks[i].name, uxTaskGetStackHighWaterMark(g_tasks[i].h));
+	js.endObj();
+
+	js.beginObj("gauge");
+	for(uint8_t i = 0; i < g_ngauges; i++){
+		uint32_t v[2] = { g_gauges[i].fn(), g_gauges[i].max };
+		js.addArrU(g_gauges[i].name, v, 2);
+	}
+	js.endObj();
+
+	i2cbus::Stats is = i2cbus::stats();
+	js.beginObj("i2c");
+	js.addU("n", is.transactions);
+	js.addU("contended", is.contended);
+	js.addU("max_wait_us", is.max_wait_us);
+	js.endObj();
+}
+
+void writeSched(JsonBuf &js){
+	if(!g_sched) return;
+	js.beginObj("sched");
+	for(uint8_t i = 0; i < g_sched->count(); i++){
+		const Scheduler::Job &j = g_sched->job(i);
+		uint32_t v[3] = { j.runs, j.overruns, j.late_max_ms };
+		js.addArrU(j.name, v, 3);
+	}
+	js.endObj();
+}
+
+uint8_t writeLatency(JsonBuf &js, uint8_t from){
+	for(uint8_t s = from; s < prof::SLOT_COUNT; s++){
+		const Hist &h = g_hist[s];
+		if(!h.n) continue;
+		if(js.remaining() < HIST_JSON_MAX) return s;
+		js.beginObj(prof::name((prof::Slot)s));
+		js.addU("n", h.n);
+		js.addU("max", h.max_us);
+		js.addU("sum_ms", (uint32_t)(h.sum_us / 1000));
+		js.addArrU("h", h.b, BUCKETS);
+		js.endObj();
+	}
+	return prof::SLOT_COUNT;
+}
+
+} // namespace metrics
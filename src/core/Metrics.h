@@ -0,0 +1,81 @@
+// =============================
+// File: core/Metrics.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../config/BuildOpts.h"
+#include "Profiler.h"
+#include "JsonOut.h"
+
+class Scheduler;
+
+// 운영 중 성능 지표
+// - 잡별(prof::Slot) 소요시간 고정 버킷 히스토그램 (CPU 사이클 카운터, 저전력 모드에서는 micros())
+// - 등록한 게이지(큐 깊이 등)의 현재값/최대값, 등록한 Task의 스택 여유(high-water mark)
+// - 힙 여유/최소/최대 블록/단편화, I2C 버스 통계, 스케줄러 잡 지연/밀림
+// 값은 단조 증가 누적치(재부팅 시 0)이므로 수집 측에서 구간 차분으로 봅니다.
+// record()/sample()은 sensorTask에서만 호출하고, 읽기(writeText/writeJson)는 다른 Task에서도 가능합니다.
+// (32비트 값 단위로만 일관성 보장, 잠금 없음)
+namespace metrics {
+	static constexpr uint8_t BUCKETS = 12;           // 마지막 버킷은 +Inf
+	extern const uint32_t BUCKET_LE_US[BUCKETS - 1]; // 버킷 상한 (us, 이하)
+	static constexpr uint8_t MAX_TASKS = 8;
+	static constexpr uint8_t MAX_GAUGES = 8;
+
+	struct Hist {
+		uint32_t n = 0;
+		uint32_t max_us = 0;
+		uint64_t sum_us = 0;
+		uint32_t b[BUCKETS] = {};       // 비누적 버킷 카운트
+	};
+
+	// 시간 측정 (사이클 카운터는 DFS로 클럭이 바뀌면 부정확하므로 저전력 모드에서는 micros())
+	inline uint32_t ticks(){
+		#if ENABLE_LOW_POWER
+			return micros();
+		#else
+			return ESP.getCycleCount();
+		#endif
+	}
+	inline uint32_t ticksToUs(uint32_t t){
+		#if ENABLE_LOW_POWER
+			return t;
+		#else
+			return t / ESP.getCpuFreqMHz();
+		#endif
+	}
+
+	void record(prof::Slot s, uint32_t us);
+	const Hist& hist(prof::Slot s);
+
+	class Scope {
+		public:
+			explicit Scope(prof::Slot s): _s(s), _t0(ticks()) {}
+			~Scope(){ record(_s, ticksToUs(ticks() - _t0)); }
+		private:
+			prof::Slot _s;
+			uint32_t   _t0;
+	};
+
+	// 등록 (setup/Task 시작 시 1회)
+	typedef uint32_t (*GaugeFn)();
+	void addTask(const char* name, TaskHandle_t h);
+	void addGauge(const char* name, GaugeFn fn);
+	void setScheduler(const Scheduler* s);
+
+	// 게이지 최대값 갱신 (발행 주기마다 호출)
+	void sample();
+
+	// Prometheus text exposition 형식 (수 KB이므로 Print로 흘려 씀, 예: 청크 전송 어댑터)
+	void writeText(Print &out);
+	// MQTT JSON (슬롯 크기에 맞춰 메시지를 나눔)
+	//   writeSystem(): 힙/스택 여유/게이지[현재,최대]/I2C
+	//   writeSched():  잡별 [실행 횟수, 밀린 주기 수, 최대 지연 ms]
+	//   writeLatency(): 슬롯 from부터 {n, max, sum_ms, h[버킷]}, 버퍼 여유가 부족하면 멈추고
+	//                   다음에 쓸 슬롯을 반환 (모두 썼으면 SLOT_COUNT)
+	void writeSystem(JsonBuf &js);
+	void writeSched(JsonBuf &js);
+	uint8_t writeLatency(JsonBuf &js, uint8_t from=0);
+} // namespace metrics
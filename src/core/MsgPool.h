@@ -0,0 +1,71 @@
+// =============================
+// File: core/MsgPool.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+// 미리 할당된 메시지 슬롯 풀 (Task 간 zero-copy 전달용)
+// - 슬롯 본체는 정적으로 한 번만 할당되고, Queue로는 슬롯 포인터(4바이트)만 오갑니다.
+// - 생산자: acquire() → data에 직접 작성 → len 설정 → post()
+// - 소비자: receive() → 사용(publish 등) → release()로 풀에 반환
+// - Queue 깊이를 늘려도 포인터 크기만큼만 RAM이 늘어납니다.
+template <uint8_t N, size_t SIZE>
+class MsgPool {
+	public:
+		struct Msg {
+			uint16_t len = 0;       // 실제 페이로드 길이
+			uint8_t  tag = 0;       // 소비자 해석용 구분값 (예: 발행 토픽)
+			uint8_t  flags = 0;     // 소비자 해석용 플래그 (예: 즉시 발행 요청)
+			char     data[SIZE];
+		};
+		static constexpr uint8_t SLOTS = N;
+		static constexpr size_t  SLOT_SIZE = SIZE;
+
+		bool begin(){
+			if(_free) return true;
+			_free  = xQueueCreate(N, sizeof(Msg*));
+			_ready = xQueueCreate(N, sizeof(Msg*));
+			if(!_free || !_ready) return false;
+			for(uint8_t i = 0; i < N; i++){
+				Msg *m = &_slots[i];
+				xQueueSend(_free, &m, 0);
+			}
+			return true;
+		}
+
+		// 빈 슬롯 획득 (없으면 nullptr)
+		Msg* acquire(TickType_t wait = 0){
+			Msg *m = nullptr;
+			if(xQueueReceive(_free, &m, wait) != pdPASS) return nullptr;
+			m->len = 0; m->tag = 0; m->flags = 0;
+			return m;
+		}
+
+		// 작성이 끝난 슬롯을 소비자에게 전달. 실패 시 슬롯은 자동으로 풀에 반환됩니다.
+		bool post(Msg *m, TickType_t wait = 0){
+			if(xQueueSend(_ready, &m, wait) == pdPASS) return true;
+			release(m);
+			return false;
+		}
+
+		// 전달된 슬롯 수신 (없으면 nullptr)
+		Msg* receive(TickType_t wait){
+			Msg *m = nullptr;
+			if(xQueueReceive(_ready, &m, wait) != pdPASS) return nullptr;
+			return m;
+		}
+
+		void release(Msg *m){
+			if(m) xQueueSend(_free, &m, 0);
+		}
+
+		UBaseType_t pending() const { return _ready ? uxQueueMessagesWaiting(_ready) : 0; }
+		UBaseType_t available() const { return _free ? uxQueueMessagesWaiting(_free) : 0; }
+
+	private:
+		Msg           _slots[N];
+		QueueHandle_t _free = nullptr;
+		QueueHandle_t _ready = nullptr;
+};
@@ -0,0 +1,71 @@
+// =============================
+// File: core/Power.cpp
+// =============================
+#include "Power.h"
+#include <esp_pm.h>
+#include <esp_idf_version.h>
+
+namespace power {
+
+namespace {
+#if CONFIG_PM_ENABLE
+	// IDF 5부터 칩 공통 esp_pm_config_t, 4.x는 타깃별 구조체 (필드 구성은 동일)
+	#if ESP_IDF_VERSION_MAJOR >= 5
+		typedef esp_pm_config_t pm_config_t;
+	#elif CONFIG_IDF_TARGET_ESP32S3
+		typedef esp_pm_config_esp32s3_t pm_config_t;
+	#elif CONFIG_IDF_TARGET_ESP32S2
+		typedef esp_pm_config_esp32s2_t pm_config_t;
+	#elif CONFIG_IDF_TARGET_ESP32C3
+		typedef esp_pm_config_esp32c3_t pm_config_t;
+	#else
+		typedef esp_pm_config_esp32_t pm_config_t;
+	#endif
+#endif
+	Mode     s_mode = PERFORMANCE;
+	bool     s_light_sleep = false;
+	uint32_t s_awake_t0 = 0;
+	uint64_t s_awake_us = 0;
+}
+
+bool begin(Mode m, const Config &cfg){
+	s_mode = m;
+	s_light_sleep = false;
+	if(m != LOW_POWER) return true;
+
+#if CONFIG_PM_ENABLE
+	pm_config_t pm = {};
+	pm.max_freq_mhz = cfg.cpu_max_mhz;
+	pm.min_freq_mhz = cfg.cpu_min_mhz;
+	#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+		pm.light_sleep_enable = cfg.light_sleep;
+	#else
+		pm.light_sleep_enable = false;
+	#endif
+	if(esp_pm_configure(&pm) != ESP_OK){
+		Serial.println(F("[POWER] esp_pm_configure failed"));
+		return false;
+	}
+	s_light_sleep = pm.light_sleep_enable;
+	Serial.printf("[POWER] DFS %u-%u MHz, light sleep %s\n", cfg.cpu_min_mhz, cfg.cpu_max_mhz, s_light_sleep ? "on" : "off");
+	return true;
+#else
+	(void)cfg;
+	Serial.println(F("[POWER] CONFIG_PM_ENABLE not set in this core, DFS/light sleep unavailable"));
+	return false;
+#endif
+}
+
+Mode mode(){ return s_mode; }
+bool lightSleepEnabled(){ return s_light_sleep; }
+
+void awakeBegin(){ s_awake_t0 = micros(); }
+void awakeEnd(){ s_awake_us += (uint32_t)(micros() - s_awake_t0); }
+
+uint32_t takeAwakeMs(){
+	uint32_t ms = (uint32_t)(s_awake_us / 1000);
+	s_awake_us -= (uint64_t)ms * 1000;
+	return ms;
+}
+
+} // namespace power
@@ -0,0 +1,30 @@
+// =============================
+// File: core/Power.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// 전원 모드 관리
+// - LOW_POWER: esp_pm 동적 주파수(DFS) + 자동 light sleep. 모든 Task가 대기 중이면 tickless idle로 잠듭니다.
+//   (ESP-IDF가 CONFIG_PM_ENABLE / CONFIG_FREERTOS_USE_TICKLESS_IDLE로 빌드된 경우에만 적용, 아니면 begin()이 false)
+// - Wi-Fi 모뎀 슬립/리슨 인터벌은 WifiLink::setPowerSave()가 담당합니다.
+// - awake 측정: sensorTask가 잡 실행에 쓴 시간을 누적하여 발행 주기마다 보고합니다.
+namespace power {
+	enum Mode : uint8_t { PERFORMANCE = 0, LOW_POWER = 1 };
+
+	struct Config {
+		uint16_t cpu_max_mhz = 160;
+		uint16_t cpu_min_mhz = 40;
+		bool     light_sleep = true;   // UART 수신이 필요하면 false (light sleep 중 UART RX 유실)
+	};
+
+	bool begin(Mode m, const Config &cfg = Config());
+	Mode mode();
+	bool lightSleepEnabled();
+
+	// sensorTask 작업 구간 (대기 → 깨어남 → 잡 실행 → 대기)
+	void awakeBegin();
+	void awakeEnd();
+	// 직전 호출 이후 누적 작업 시간 (ms)
+	uint32_t takeAwakeMs();
+} // namespace power
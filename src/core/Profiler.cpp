@@ -0,0 +1,79 @@
+// =============================
+// File: core/Profiler.cpp
+// =============================
+#include "Profiler.h"
+#include <esp_heap_caps.h>
+#if ENABLE_METRICS
+#include "Metrics.h"
+#endif
+
+namespace {
+	prof::Stats g_stats[prof::SLOT_COUNT];
+	uint32_t    g_t0[prof::SLOT_COUNT];
+	int32_t     g_blocks0[prof::SLOT_COUNT];
+	int32_t     g_bytes0[prof::SLOT_COUNT];
+	uint32_t    g_cycles = 0;
+
+	const char* const kNames[prof::SLOT_COUNT] = {
+		"sps30", "bme688", "smoke2", "sgp30", "co_adc", "mq2",
+		"ads_aux", "mic", "sen0177", "ze07", "publish", "cycle"
+	};
+
+	void heap_now(int32_t &blocks, int32_t &bytes){
+		multi_heap_info_t info;
+		heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+		blocks = (int32_t)info.allocated_blocks;
+		bytes  = (int32_t)info.total_allocated_bytes;
+	}
+} // anonymous namespace
+
+namespace prof {
+
+void begin(Slot s){
+	heap_now(g_blocks0[s], g_bytes0[s]);
+	g_t0[s] = micros(); // 힙 조회 이후에 시작 시각 기록
+}
+
+void end(Slot s){
+	uint32_t dt = micros() - g_t0[s];
+	int32_t blocks, bytes;
+	heap_now(blocks, bytes);
+
+	Stats &st = g_stats[s];
+	st.count++;
+	st.last_us = dt;
+	st.sum_us += dt;
+	if(dt < st.min_us) st.min_us = dt;
+	if(dt > st.max_us) st.max_us = dt;
+	st.heap_blocks += blocks - g_blocks0[s];
+	st.heap_bytes  += bytes  - g_bytes0[s];
+	#if ENABLE_METRICS
+	metrics::record(s, dt);
+	#endif
+}
+
+const Stats& stats(Slot s){ return g_stats[s]; }
+
+const char* name(Slot s){ return (s < SLOT_COUNT) ? kNames[s] : "?"; }
+
+void reset(){
+	for(uint8_t i = 0; i < SLOT_COUNT; i++) g_stats[i] = Stats();
+}
+
+void report(Stream &out, uint32_t every){
+	if(++g_cycles < every) return;
+	g_cycles = 0;
+
+	out.printf("[PROF] %-8s %6s %8s %8s %8s %7s %8s\n", "slot", "n", "avg_us", "min_us", "max_us", "dBlk", "dBytes");
+	for(uint8_t i = 0; i < SLOT_COUNT; i++){
+		const Stats &st = g_stats[i];
+		if(st.count == 0) continue;
+		out.printf("[PROF] %-8s %6u %8u %8u %8u %7d %8d\n",
+			kNames[i], (unsigned)st.count, (unsigned)(st.sum_us / st.count),
+			(unsigned)st.min_us, (unsigned)st.max_us, (int)st.heap_blocks, (int)st.heap_bytes);
+	}
+	out.printf("[PROF] free_heap=%u max_alloc=%u\n", (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMaxAllocHeap());
+	reset();
+}
+
+} // namespace prof
@@ -0,0 +1,64 @@
+// =============================
+// File: core/Profiler.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include "../config/BuildOpts.h"
+
+// sensorTask 사이클 프로파일러
+// - 드라이버별/전체 사이클 소요시간(us)을 누적하고, 구간 전후의 힙 블록/바이트 변화를 기록합니다.
+// - 힙 측정은 시간 측정 구간 밖에서 수행되므로 latency 값에는 포함되지 않습니다.
+// - 힙 변화는 heap_caps_get_info() 전역 값의 차이라 같은 시간에 돈 다른 Task(Wi-Fi/MQTT 등)의
+//   할당도 섞입니다. 참고용이며, 드라이버별 할당 수는 호스트 벤치(host/, 스레드별 malloc 계수)로 봅니다.
+// - ENABLE_CYCLE_PROFILE=0 이면 PROF_SCOPE()는 ENABLE_METRICS일 때 히스토그램 기록(metrics::Scope)만,
+//   둘 다 0이면 아무 코드도 만들지 않습니다. (PROF_SCOPE 사용처는 core/Metrics.h도 include)
+namespace prof {
+	enum Slot : uint8_t {
+		SLOT_SPS30 = 0,
+		SLOT_BME688,
+		SLOT_SMOKE2,
+		SLOT_SGP30,
+		SLOT_CO_ADC,
+		SLOT_MQ2,
+		SLOT_ADS_AUX,
+		SLOT_MIC,
+		SLOT_SEN0177,
+		SLOT_ZE07,
+		SLOT_PUBLISH,
+		SLOT_CYCLE,
+		SLOT_COUNT
+	};
+
+	struct Stats {
+		uint32_t count = 0;
+		uint32_t last_us = 0, min_us = UINT32_MAX, max_us = 0;
+		uint64_t sum_us = 0;
+		int32_t  heap_blocks = 0;   // 누적 순(純) 할당 블록 수 변화 (전역, 다른 Task 포함)
+		int32_t  heap_bytes = 0;    // 누적 순 할당 바이트 변화 (전역, 다른 Task 포함)
+	};
+
+	void begin(Slot s);
+	void end(Slot s);
+	const Stats& stats(Slot s);
+	const char* name(Slot s);
+
+	// SLOT_CYCLE 종료 시 호출. every 사이클마다 통계를 출력하고 초기화합니다.
+	void report(Stream &out, uint32_t every = PROF_REPORT_EVERY);
+	void reset();
+
+	class Scope {
+		public:
+			explicit Scope(Slot s): _s(s) { begin(_s); }
+			~Scope() { end(_s); }
+		private:
+			Slot _s;
+	};
+} // namespace prof
+
+#if ENABLE_CYCLE_PROFILE
+	#define PROF_SCOPE(slot) prof::Scope _prof_scope_##slot(prof::slot)
+#elif ENABLE_METRICS
+	#define PROF_SCOPE(slot) metrics::Scope _prof_scope_##slot(prof::slot)
+#else
+	#define PROF_SCOPE(slot) do {} while (0)
+#endif
@@ -0,0 +1,61 @@
+// =============================
+// File: core/Rollup.cpp
+// =============================
+#include "Rollup.h"
+
+namespace telem {
+
+namespace {
+	constexpr size_t FIELD_JSON_MAX = 128;   // "key":{"min":..,"max":..,"mean":..,"sd":..,"n":..} 최대 길이 + 닫는 " }"
+}
+
+void Rollup::begin(uint32_t window_s, uint32_t now_ms, uint32_t epoch){
+	_win_s = window_s;
+	next(now_ms, epoch);
+}
+
+void Rollup::schedule_(uint32_t now_ms, uint32_t epoch){
+	uint32_t len_s = _win_s;
+	if(epoch) len_s = _win_s - epoch % _win_s;    // 벽시계 배수에 정렬
+	_end_ms = now_ms + len_s * 1000UL;
+	_start_epoch = epoch;
+}
+
+void Rollup::next(uint32_t now_ms, uint32_t epoch){
+	for(uint8_t i = 0; i < FIELD_COUNT; i++) _st[i].reset();
+	_mask = 0;
+	if(_win_s) schedule_(now_ms, epoch);
+}
+
+void Rollup::add(const Sample &s){
+	uint32_t m = s.mask;
+	while(m){
+		uint8_t i = __builtin_ctz(m);
+		m &= m - 1;
+		float x = s.asFloat((Field)i);
+		if(isnan(x)) continue;
+		_st[i].add(x);
+		_mask |= 1UL << i;
+	}
+}
+
+uint8_t Rollup::writeJson(JsonBuf &js, uint8_t from) const {
+	for(uint8_t i = from; i < FIELD_COUNT; i++){
+		if(!(_mask & (1UL << i))) continue;
+		if(js.remaining() < FIELD_JSON_MAX) return i;
+
+		const filt::Welford<float> &w = _st[i];
+		uint8_t d = FIELDS[i].digits;
+		uint8_t dm = d < 2 ? 2 : d;              // 평균/표준편차는 정수 필드도 소수 2자리
+		js.beginObj(FIELDS[i].key);
+		js.add("min", w.lowest(), d);
+		js.add("max", w.highest(), d);
+		js.add("mean", w.mean(), dm);
+		js.add("sd", w.stddev(), dm);
+		js.addU("n", w.count());
+		js.endObj();
+	}
+	return FIELD_COUNT;
+}
+
+} // namespace telem
@@ -0,0 +1,42 @@
+// =============================
+// File: core/Rollup.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include "Telemetry.h"
+#include "JsonOut.h"
+#include "Filters.h"
+
+// 구간 통계 집계 (min/max/mean/sd/n, 필드별 filt::Welford - 샘플당 O(1))
+// - 발행 잡이 매 주기 add()로 스냅샷을 넣고, due()가 되면 writeJson()으로 결과를 쓴 뒤 next()로 다음 구간을 시작합니다.
+// - 시계가 동기화되어 있으면 구간 끝을 벽시계 배수(예: 매 정각 분)에 맞춥니다. (첫 구간은 짧을 수 있음)
+// - 배열 필드와 NAN 값은 집계하지 않습니다.
+// - 발행 잡(sensorTask)에서만 사용하며 내부 잠금은 없습니다.
+namespace telem {
+	class Rollup {
+		public:
+			void begin(uint32_t window_s, uint32_t now_ms, uint32_t epoch);
+			uint32_t window() const { return _win_s; }
+
+			void add(const Sample &s);
+			bool due(uint32_t now_ms) const { return _win_s && (int32_t)(now_ms - _end_ms) >= 0; }
+			bool empty() const { return _mask == 0; }
+
+			// 필드 통계를 from 필드부터 js에 씁니다. 버퍼 여유가 부족하면 멈추고 다음에 쓸 필드 인덱스를 반환
+			// (모두 썼으면 FIELD_COUNT). 큰 구간 결과는 여러 메시지로 나누어 발행할 수 있습니다.
+			uint8_t writeJson(JsonBuf &js, uint8_t from=0) const;
+			uint32_t startEpoch() const { return _start_epoch; }   // 0이면 시계 미동기
+
+			// 다음 구간 시작 (집계 초기화)
+			void next(uint32_t now_ms, uint32_t epoch);
+
+		private:
+			void schedule_(uint32_t now_ms, uint32_t epoch);
+
+			uint32_t _win_s = 0;
+			uint32_t _end_ms = 0;
+			uint32_t _start_epoch = 0;
+			uint32_t _mask = 0;                  // 값이 하나라도 들어온 필드
+			filt::Welford<float> _st[FIELD_COUNT];
+	};
+} // namespace telem
@@ -0,0 +1,85 @@
+// =============================
+// File: core/Scheduler.cpp
+// =============================
+#include "Scheduler.h"
+
+int8_t Scheduler::add(const char* name, uint32_t period_ms, JobFn fn, void* ctx, uint32_t phase_ms){
+	if(_n >= MAX_JOBS || !fn || period_ms == 0) return -1;
+	Job &j = _jobs[_n];
+	j = Job();
+	j.name = name; j.fn = fn; j.ctx = ctx;
+	j.period_ms = period_ms;
+	j.next_ms = millis() + phase_ms;
+	return (int8_t)_n++;
+}
+
+void Scheduler::setEnabled(int8_t id, bool on){
+	if(id < 0 || id >= _n) return;
+	Job &j = _jobs[id];
+	if(on && !j.enabled) j.next_ms = millis(); // 재활성화 시 즉시 실행
+	j.enabled = on;
+}
+
+void Scheduler::setPeriod(int8_t id, uint32_t period_ms){
+	if(id < 0 || id >= _n || period_ms == 0) return;
+	_jobs[id].period_ms = period_ms;
+}
+
+void Scheduler::kick(int8_t id){
+	if(id < 0 || id >= _n) return;
+	_jobs[id].next_ms = millis();
+}
+
+uint32_t Scheduler::msUntilNext() const {
+	uint32_t now = millis();
+	uint32_t best = UINT32_MAX;
+	for(uint8_t i=0;i<_n;i++){
+		const Job &j = _jobs[i];
+		if(!j.enabled) continue;
+		if(due_(now, j.next_ms)) return 0;
+		uint32_t dt = j.next_ms - now;
+		if(dt < best) best = dt;
+	}
+	return best;
+}
+
+void Scheduler::waitNext(uint32_t max_wait_ms){
+	uint32_t dt = msUntilNext();
+	if(dt > max_wait_ms) dt = max_wait_ms;
+	if(dt > 0) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(dt)); // xTaskNotifyGive로 조기 기상 가능
+}
+
+uint8_t Scheduler::dispatch(){
+	uint8_t ran = 0;
+	// 마감된 잡 중 가장 이른 마감시각부터 하나씩 실행 (실행 중 시간이 흐르므로 매번 재탐색)
+	for(;;){
+		uint32_t now = millis();
+		int8_t pick = -1;
+		for(uint8_t i=0;i<_n;i++){
+			const Job &j = _jobs[i];
+			if(!j.enabled || !due_(now, j.next_ms)) continue;
+			if(pick < 0 || (int32_t)(j.next_ms - _jobs[pick].next_ms) < 0) pick = i;
+		}
+		if(pick < 0 || ran >= _n * 2) break; // 한 번의 dispatch에서 무한 반복 방지
+
+		Job &j = _jobs[pick];
+		uint32_t late = now - j.next_ms;
+		if(late > j.late_max_ms) j.late_max_ms = late;
+
+		uint32_t next_delay = j.fn(j.ctx, now);
+		j.runs++; ran++;
+
+		if(next_delay > 0){
+			j.next_ms = millis() + next_delay;
+		} else {
+			j.next_ms += j.period_ms;
+			// 한 주기 이상 밀렸다면 따라잡기 대신 다음 주기로 건너뜀
+			uint32_t after = millis();
+			if(due_(after, j.next_ms)){
+				j.overruns++;
+				j.next_ms = after + j.period_ms;
+			}
+		}
+	}
+	return ran;
+}
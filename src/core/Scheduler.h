@@ -0,0 +1,53 @@
+// =============================
+// File: core/Scheduler.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// 마감시각(deadline) 기반 다중 주기 스케줄러
+// - 센서마다 자기 주기(period)와 읽기 함수(job)를 등록합니다.
+// - 가장 이른 마감시각까지 vTaskDelay로 대기한 뒤, 마감된 잡을 마감시각 순서로 실행합니다.
+//   (마감시각이 같으면 등록 순서대로 실행)
+// - 잡 함수의 반환값은 다음 실행까지의 지연(ms)입니다. 0이면 등록된 주기를 그대로 사용합니다.
+//   (예: BME688 히터 대기처럼 한 번만 다른 시점에 다시 불려야 하는 경우)
+// - 시간 기준은 millis() (esp_timer 기반)이며, 주기 잡은 드리프트 없이 next += period로 갱신됩니다.
+class Scheduler {
+	public:
+		typedef uint32_t (*JobFn)(void *ctx, uint32_t now_ms);
+
+		static constexpr uint8_t MAX_JOBS = 16;
+
+		struct Job {
+			const char* name = nullptr;
+			JobFn    fn = nullptr;
+			void*    ctx = nullptr;
+			uint32_t period_ms = 0;
+			uint32_t next_ms = 0;
+			bool     enabled = true;
+			// 통계
+			uint32_t runs = 0;
+			uint32_t late_max_ms = 0;   // 마감 대비 최대 지연
+			uint32_t overruns = 0;      // 한 주기 이상 밀려서 건너뛴 횟수
+		};
+
+		// 잡 등록. phase_ms 만큼 첫 실행을 늦춥니다. 실패 시 -1
+		int8_t add(const char* name, uint32_t period_ms, JobFn fn, void* ctx=nullptr, uint32_t phase_ms=0);
+		void setEnabled(int8_t id, bool on);
+		void setPeriod(int8_t id, uint32_t period_ms);
+		void kick(int8_t id);                   // 다음 dispatch에서 즉시 실행
+
+		// 다음 마감시각까지 대기 (최대 max_wait_ms). 다른 Task/ISR이 이 Task에 알림을 주면 즉시 반환
+		void waitNext(uint32_t max_wait_ms=1000);
+		// 마감된 잡을 모두 실행하고 실행한 개수를 반환
+		uint8_t dispatch();
+		// 다음 마감시각까지 남은 시간(ms)
+		uint32_t msUntilNext() const;
+
+		uint8_t count() const { return _n; }
+		const Job& job(uint8_t i) const { return _jobs[i]; }
+
+	private:
+		static bool due_(uint32_t now, uint32_t t){ return (int32_t)(now - t) >= 0; }
+		Job     _jobs[MAX_JOBS];
+		uint8_t _n = 0;
+};
@@ -0,0 +1,42 @@
+// =============================
+// File: core/Telemetry.cpp
+// =============================
+#include "Telemetry.h"
+
+namespace telem {
+
+// 키/자릿수는 기존 sensorTask 페이로드와 동일하게 유지
+const FieldInfo FIELDS[FIELD_COUNT] = {
+	{ "pm1_0",       KIND_F32, 2 },
+	{ "pm2_5",       KIND_F32, 2 },
+	{ "pm4_0",       KIND_F32, 2 },
+	{ "pm10",        KIND_F32, 2 },
+	{ "temp",        KIND_F32, 2 },
+	{ "hum",         KIND_F32, 2 },
+	{ "gas_kohm",    KIND_F32, 3 },
+	{ "smk_blue",    KIND_U32, 0 },
+	{ "smk_ir",      KIND_U32, 0 },
+	{ "smk_ratio",   KIND_F32, 3 },
+	{ "smk_alpha",   KIND_F32, 3 },
+	{ "smk_score",   KIND_F32, 0 },
+	{ "smk_alarm",   KIND_U32, 0 },
+	{ "eCO2_ppm",    KIND_U32, 0 },
+	{ "TVOC_ppb",    KIND_U32, 0 },
+	{ "CO_V",        KIND_F32, 2 },
+	{ "CO_ppm",      KIND_F32, 2 },
+	{ "mq2_mV",      KIND_F32, 2 },
+	{ "mq2_Rs",      KIND_F32, 0 },
+	{ "mq2_ratio",   KIND_F32, 2 },
+	{ "mq2_ema",     KIND_F32, 2 },
+	{ "Smoke_mV",    KIND_F32, 2 },
+	{ "mic_rms",     KIND_F32, 0 },
+	{ "ZE07_CO_ppm", KIND_F32, 1 },
+	{ "gas_fp",      KIND_F32_VEC, 2 },   // BME688 히터 프로파일 스캔 가스 저항(kOhm) 벡터
+	{ "mq2_ppm",     KIND_F32, 1 },       // MQ-2 Rs/R0 → ppm (core/CalCurve.h 교정 곡선)
+	{ "mic_peak",    KIND_F32, 0 },       // 마이크 구간 최대 |샘플| (mic_rms와 같은 단위)
+	{ "mic_laeq",    KIND_F32, 1 },       // 마이크 구간 A가중 Leq [dB SPL]
+	{ "mic_laeq_long", KIND_F32, 1 },     // 마이크 긴 구간(MIC_LEQ_WINDOWS) A가중 Leq [dB SPL]
+	{ "awake_ms",    KIND_U32, 0 },       // 저전력 모드: 직전 발행 이후 sensorTask 작업 시간
+};
+
+} // namespace telem
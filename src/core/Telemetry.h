@@ -0,0 +1,80 @@
+// =============================
+// File: core/Telemetry.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// 센서 잡들이 갱신하고, 발행 잡이 직렬화하는 텔레메트리 스냅샷
+// - 필드 순서는 JSON 출력 순서와 같습니다. (기존 페이로드 키/자릿수 유지)
+// - mask 비트가 켜진 필드만 출력되며, 발행 후 clear()로 비웁니다.
+namespace telem {
+	enum Field : uint8_t {
+		F_PM1_0 = 0, F_PM2_5, F_PM4_0, F_PM10,
+		F_TEMP, F_HUM, F_GAS_KOHM,
+		F_SMK_BLUE, F_SMK_IR, F_SMK_RATIO, F_SMK_ALPHA, F_SMK_SCORE, F_SMK_ALARM,
+		F_ECO2, F_TVOC,
+		F_CO_V, F_CO_PPM,
+		F_MQ2_MV, F_MQ2_RS, F_MQ2_RATIO, F_MQ2_EMA,
+		F_SMOKE_MV,
+		F_MIC_RMS,
+		F_ZE07_CO_PPM,
+		F_GAS_FP,
+		F_MQ2_PPM,
+		F_MIC_PEAK, F_MIC_LAEQ, F_MIC_LAEQ_LONG,
+		F_AWAKE_MS,
+		FIELD_COUNT
+	};
+	static_assert(FIELD_COUNT <= 32, "field mask is 32-bit");
+
+	// KIND_F32_VEC: float 배열 (Sample::vec에 보관, 스냅샷당 1개 필드만 사용 - 현재 F_GAS_FP)
+	enum Kind : uint8_t { KIND_F32 = 0, KIND_U32 = 1, KIND_F32_VEC = 2 };
+	static constexpr uint8_t VEC_MAX = 10;
+
+	struct FieldInfo {
+		const char* key;
+		Kind        kind;
+		uint8_t     digits;   // KIND_F32 소수점 자릿수
+	};
+	extern const FieldInfo FIELDS[FIELD_COUNT];
+
+	union Value { float f; uint32_t u; };
+
+	struct Sample {
+		uint32_t mask = 0;
+		Value    v[FIELD_COUNT];     // KIND_F32_VEC 필드는 v[f].u = 원소 수
+		float    vec[VEC_MAX];
+
+		void setF(Field f, float x){ v[f].f = x; mask |= (1UL << f); }
+		void setU(Field f, uint32_t x){ v[f].u = x; mask |= (1UL << f); }
+		void setVec(Field f, const float* x, uint8_t n){
+			if(n > VEC_MAX) n = VEC_MAX;
+			memcpy(vec, x, n * sizeof(float));
+			v[f].u = n; mask |= (1UL << f);
+		}
+		bool has(Field f) const { return mask & (1UL << f); }
+		float f(Field k) const { return v[k].f; }
+		uint32_t u(Field k) const { return v[k].u; }
+		// 종류와 상관없이 float 값 (비교/통계용, 배열 필드는 NAN)
+		float asFloat(Field k) const {
+			switch(FIELDS[k].kind){
+				case KIND_U32: return (float)v[k].u;
+				case KIND_F32: return v[k].f;
+				default:       return NAN;
+			}
+		}
+		void clear(){ mask = 0; }
+		bool empty() const { return mask == 0; }
+	};
+
+	// JsonBuf writer(add/addU/addArr)에 mask된 필드를 순서대로 출력
+	template <class W>
+	void writeJson(W &js, const Sample &s){
+		for(uint8_t i = 0; i < FIELD_COUNT; i++){
+			if(!(s.mask & (1UL << i))) continue;
+			const FieldInfo &fi = FIELDS[i];
+			if(fi.kind == KIND_U32)          js.addU(fi.key, s.v[i].u);
+			else if(fi.kind == KIND_F32_VEC) js.addArr(fi.key, s.vec, (uint8_t)s.v[i].u, fi.digits);
+			else                             js.add(fi.key, s.v[i].f, fi.digits);
+		}
+	}
+} // namespace telem
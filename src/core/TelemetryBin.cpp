@@ -0,0 +1,49 @@
+// =============================
+// File: core/TelemetryBin.cpp
+// =============================
+#include "TelemetryBin.h"
+
+namespace {
+	inline void put_u32le(uint8_t *p, uint32_t v){
+		p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+	}
+}
+
+namespace telem {
+
+size_t encodeBinary(const Sample &s, uint32_t ts, uint8_t *out, size_t cap){
+	size_t need = TELEM_BIN_HEADER + 4 * (size_t)__builtin_popcount(s.mask);
+	for(uint8_t i = 0; i < FIELD_COUNT; i++)
+		if(FIELDS[i].kind == KIND_F32_VEC && (s.mask & (1UL << i))) need += 4 * s.v[i].u;
+	if(!out || cap < need) return 0;
+
+	out[0] = TELEM_BIN_MAGIC;
+	out[1] = TELEM_BIN_VERSION;
+	out[2] = FIELD_COUNT;
+	out[3] = 0;
+	put_u32le(out + 4, s.mask);
+	put_u32le(out + 8, ts);
+
+	uint8_t *p = out + TELEM_BIN_HEADER;
+	for(uint8_t i = 0; i < FIELD_COUNT; i++){
+		if(!(s.mask & (1UL << i))) continue;
+		uint32_t raw;
+		if(FIELDS[i].kind == KIND_F32_VEC){
+			put_u32le(p, s.v[i].u);
+			p += 4;
+			for(uint32_t k = 0; k < s.v[i].u; k++){
+				memcpy(&raw, &s.vec[k], sizeof(raw));
+				put_u32le(p, raw);
+				p += 4;
+			}
+			continue;
+		}
+		if(FIELDS[i].kind == KIND_U32) raw = s.v[i].u;
+		else memcpy(&raw, &s.v[i].f, sizeof(raw));
+		put_u32le(p, raw);
+		p += 4;
+	}
+	return need;
+}
+
+} // namespace telem
@@ -0,0 +1,30 @@
+// =============================
+// File: core/TelemetryBin.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include "Telemetry.h"
+
+// 고정 스키마 바이너리 텔레메트리 레코드 (little-endian)
+//
+//   off  size  내용
+//   0    1     magic   (0xA7)
+//   1    1     version (TELEM_BIN_VERSION)
+//   2    1     field_count (telem::FIELD_COUNT, 디코더 스키마 확인용)
+//   3    1     flags   (예약, 0)
+//   4    4     mask    (필드 존재 비트맵, bit i = telem::Field i)
+//   8    4     ts      (epoch 초, 시계 미동기 시 0)
+//   12   4*n   값      (mask에 켜진 필드만 필드 순서대로, KIND_F32=float32 / KIND_U32=uint32)
+//                      KIND_F32_VEC = uint32 원소 수 k + float32 * k (v2부터)
+//
+// 필드 순서/종류는 core/Telemetry.cpp의 FIELDS 테이블이 정의하며,
+// 필드를 추가할 때는 끝에만 추가하고 tools/telemetry_bin_decode.py도 함께 갱신합니다.
+namespace telem {
+	static constexpr uint8_t TELEM_BIN_MAGIC   = 0xA7;
+	static constexpr uint8_t TELEM_BIN_VERSION = 5;
+	static constexpr size_t  TELEM_BIN_HEADER  = 12;
+	static constexpr size_t  TELEM_BIN_MAX     = TELEM_BIN_HEADER + 4 * FIELD_COUNT + 4 * VEC_MAX;
+
+	// 인코딩된 길이를 반환. cap이 부족하면 0
+	size_t encodeBinary(const Sample &s, uint32_t ts, uint8_t *out, size_t cap);
+} // namespace telem
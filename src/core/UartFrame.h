@@ -0,0 +1,103 @@
+// =============================
+// File: core/UartFrame.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// UART 고정 길이 프레임 수신기 (스트리밍 상태 머신)
+// - H0/H1 : 헤더 바이트 (H1 < 0 이면 1바이트 헤더)
+// - LEN   : 헤더 포함 전체 프레임 길이
+// - VALID : 체크섬 등 프레임 검증 함수 (frame[0..LEN-1])
+//
+// attach()하면 HardwareSerial::onReceive 콜백(UART 이벤트 Task)에서 바이트를 바로 소비하고,
+// 검증된 최신 프레임 1개와 수신 시각만 보관합니다. 읽는 쪽은 latest()로 O(1) 복사만 합니다.
+// 검증 실패 시 버퍼 안에서 다음 헤더 후보로 재동기화하므로 바이트를 잃지 않습니다.
+template <uint8_t H0, int16_t H1, size_t LEN, bool (*VALID)(const uint8_t*)>
+class UartFrame {
+	public:
+		static constexpr size_t FRAME_LEN = LEN;
+		static constexpr uint8_t HDR_LEN = (H1 < 0) ? 1 : 2;
+
+		struct Stats {
+			uint32_t frames = 0;     // 검증 통과
+			uint32_t bad = 0;        // 검증 실패 (재동기화)
+		};
+
+		// 수신 콜백 등록. 이후 바이트는 UART 이벤트 Task에서 처리됩니다.
+		void attach(HardwareSerial &ser){
+			_ser = &ser;
+			while(ser.available()) ser.read();    // 부팅 전 쌓인 오래된 바이트 폐기
+			ser.onReceive([this](){ drain_(); });
+			_attached = true;
+		}
+
+		// 콜백 없이 쓰는 경우: 쌓인 바이트를 대기 없이 소비
+		void poll(){ if(_ser && !_attached) drain_(); }
+
+		// 바이트 1개 입력
+		void feed(uint8_t b){
+			if(_n == 0 && b != H0) return;
+			if(H1 >= 0 && _n == 1 && b != (uint8_t)H1){
+				_n = (b == H0) ? 1 : 0;
+				return;
+			}
+			_buf[_n++] = b;
+			if(_n < LEN) return;
+
+			if(VALID(_buf)){
+				portENTER_CRITICAL(&_mux);
+				memcpy(_latest, _buf, LEN);
+				_latest_ms = millis();
+				_seq++;
+				portEXIT_CRITICAL(&_mux);
+				_stats.frames++;
+				_n = 0;
+			} else {
+				_stats.bad++;
+				resync_();
+			}
+		}
+
+		// 가장 최근 검증 프레임 복사. max_age_ms보다 오래되었거나 아직 없으면 false
+		bool latest(uint8_t *out, uint32_t max_age_ms=UINT32_MAX, uint32_t *seq=nullptr) const {
+			portENTER_CRITICAL(&_mux);
+			uint32_t s = _seq, t = _latest_ms;
+			if(s) memcpy(out, _latest, LEN);
+			portEXIT_CRITICAL(&_mux);
+			if(seq) *seq = s;
+			return s != 0 && (millis() - t) <= max_age_ms;
+		}
+
+		uint32_t seq() const { return _seq; }
+		uint32_t ageMs() const { return _seq ? millis() - _latest_ms : UINT32_MAX; }
+		const Stats& stats() const { return _stats; }
+
+	private:
+		void drain_(){
+			while(_ser->available() > 0) feed((uint8_t)_ser->read());
+		}
+
+		// 버퍼 1번째 바이트 이후에서 다음 헤더 후보를 찾아 앞으로 당김
+		void resync_(){
+			size_t i = 1;
+			for(; i < _n; i++){
+				if(_buf[i] != H0) continue;
+				if(H1 >= 0 && i + 1 < _n && _buf[i + 1] != (uint8_t)H1) continue;
+				break;
+			}
+			_n -= i;
+			memmove(_buf, _buf + i, _n);
+		}
+
+		HardwareSerial *_ser = nullptr;
+		bool     _attached = false;
+		uint8_t  _buf[LEN];
+		size_t   _n = 0;
+
+		uint8_t  _latest[LEN];
+		volatile uint32_t _latest_ms = 0;
+		volatile uint32_t _seq = 0;
+		mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+		Stats    _stats;
+};
@@ -0,0 +1,108 @@
+// =============================
+// File: core/WarmState.cpp
+// =============================
+#include "WarmState.h"
+#include <Preferences.h>
+
+namespace warm {
+
+namespace {
+	constexpr uint32_t MAGIC = 0x57524D31; // "WRM1"
+
+	struct Header {
+		uint32_t magic;
+		uint16_t schema;
+		uint16_t len;
+		uint32_t epoch;     // 저장 시각 (epoch 초, 미동기면 0)
+		uint32_t crc;       // magic~epoch + 데이터
+	};
+
+	struct Image {
+		Header  h;
+		uint8_t data[CAP];
+	};
+
+	RTC_NOINIT_ATTR Image s_rtc;
+
+	uint32_t crc32_(uint32_t crc, const uint8_t* p, size_t n){
+		crc = ~crc;
+		while(n--){
+			crc ^= *p++;
+			for(uint8_t k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+		}
+		return ~crc;
+	}
+
+	uint32_t imageCrc_(const Image &im){
+		uint32_t c = crc32_(0, (const uint8_t*)&im.h, offsetof(Header, crc));
+		return crc32_(c, im.data, im.h.len);
+	}
+
+	void fill_(Image &im, const void* data, uint16_t len, uint16_t schema, uint32_t epoch){
+		im.h.magic = MAGIC; im.h.schema = schema; im.h.len = len; im.h.epoch = epoch;
+		memcpy(im.data, data, len);
+		im.h.crc = imageCrc_(im);
+	}
+
+	bool valid_(const Image &im, uint16_t len, uint16_t schema, uint32_t now, uint32_t max_age_s){
+		if(im.h.magic != MAGIC || im.h.schema != schema || im.h.len != len) return false;
+		if(im.h.crc != imageCrc_(im)) return false;
+		if(now && im.h.epoch && (now < im.h.epoch || now - im.h.epoch > max_age_s)) return false;
+		return true;
+	}
+
+	const char* NVS_NS = "warm";
+}
+
+void saveRtc(const void* data, uint16_t len, uint16_t schema, uint32_t epoch){
+	if(len > CAP) return;
+	fill_(s_rtc, data, len, schema, epoch);
+}
+
+bool saveNvs(const void* data, uint16_t len, uint16_t schema, uint32_t epoch){
+	if(len > CAP) return false;
+	static Image im;   // 재시작 직전 1회 사용 (스택 절약)
+	fill_(im, data, len, schema, epoch);
+	Preferences p;
+	if(!p.begin(NVS_NS, false)) return false;
+	bool ok = p.putBytes("snap", &im, sizeof(Header) + len) == sizeof(Header) + len;
+	p.end();
+	return ok;
+}
+
+Source load(void* data, uint16_t len, uint16_t schema, uint32_t now, uint32_t max_age_s){
+	if(len > CAP) return NONE;
+	Source src = NONE;
+
+	if(valid_(s_rtc, len, schema, now, max_age_s)){
+		memcpy(data, s_rtc.data, len);
+		src = RTC;
+	}
+
+	Preferences p;
+	if(p.begin(NVS_NS, false)){
+		if(p.isKey("snap")){
+			if(src == NONE){
+				static Image im;
+				size_t n = p.getBytes("snap", &im, sizeof(im));
+				if(n == sizeof(Header) + len && valid_(im, len, schema, now, max_age_s)){
+					memcpy(data, im.data, len);
+					src = NVS;
+				}
+			}
+			p.remove("snap");   // 1회용: 이후 전원 재투입 시 오래된 상태를 복원하지 않도록
+		}
+		p.end();
+	}
+	return src;
+}
+
+const char* sourceName(Source s){
+	switch(s){
+		case RTC: return "rtc";
+		case NVS: return "nvs";
+		default:  return "none";
+	}
+}
+
+} // namespace warm
@@ -0,0 +1,24 @@
+// =============================
+// File: core/WarmState.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// 재부팅 후 센서 필터 상태를 바로 이어 쓰기 위한 스냅샷 저장소 (warm restart)
+// - saveRtc(): RTC 슬로 메모리(RTC_NOINIT)에 저장. 소프트 리셋/패닉/WDT 리셋 후에도 유지되며 플래시 쓰기가 없어 주기 저장용
+// - saveNvs(): NVS에 1회 저장. 펌웨어 교체(OTA)로 RTC 변수 배치가 바뀌는 재시작 직전에 사용
+// - load(): RTC → NVS 순으로 찾아 CRC/스키마/길이/나이를 확인한 뒤 복사. NVS 스냅샷은 읽으면 지움 (1회용)
+// 내용은 호출 측이 정한 구조체(POD)이며, 구조가 바뀌면 schema 값을 올립니다.
+namespace warm {
+	static constexpr uint16_t CAP = 192;   // 스냅샷 최대 크기 (바이트)
+
+	enum Source : uint8_t { NONE = 0, RTC = 1, NVS = 2 };
+
+	void saveRtc(const void* data, uint16_t len, uint16_t schema, uint32_t epoch);
+	bool saveNvs(const void* data, uint16_t len, uint16_t schema, uint32_t epoch);
+
+	// epoch_now/저장 시각 중 하나라도 0(시계 미동기)이면 나이 검사는 생략
+	Source load(void* data, uint16_t len, uint16_t schema, uint32_t epoch_now, uint32_t max_age_s);
+
+	const char* sourceName(Source s);
+} // namespace warm
@@ -0,0 +1,146 @@
+// =============================
+// File: core/WifiLink.cpp
+// =============================
+#include "WifiLink.h"
+#include <esp_wifi.h>
+
+uint32_t Backoff::next(){
+	uint32_t d = _base;
+	for(uint8_t i = 0; i < _n && d < _max; i++) d <<= 1;
+	if(d > _max) d = _max;
+	if(_n < 31) _n++;
+	return d + (esp_random() % (d / 2 + 1));
+}
+
+WifiLink* WifiLink::s_self = nullptr;
+
+void WifiLink::onEvent_(WiFiEvent_t event, WiFiEventInfo_t info){
+	WifiLink *self = s_self;
+	if(!self) return;
+	switch(event){
+		case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+			self->_ev_got_ip++;
+			break;
+		case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+			self->_ev_reason = info.wifi_sta_disconnected.reason;
+			self->_ev_disc++;
+			break;
+		case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+			self->_ev_disc++;
+			break;
+		default:
+			break;
+	}
+}
+
+void WifiLink::begin(const char* ssid, const char* pass, uint32_t connect_timeout_ms){
+	_ssid = ssid; _pass = pass;
+	_timeout_ms = connect_timeout_ms;
+
+	// 재연결은 이 상태 머신이 직접 관리 (드라이버 자동 재연결과 겹치지 않도록)
+	WiFi.setAutoReconnect(false);
+	if(_listen) WiFi.setSleep(WIFI_PS_MAX_MODEM);
+	if(!s_self){
+		s_self = this;
+		WiFi.onEvent(onEvent_, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+		WiFi.onEvent(onEvent_, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+		WiFi.onEvent(onEvent_, ARDUINO_EVENT_WIFI_STA_LOST_IP);
+	}
+	_seen_got_ip = _ev_got_ip;
+	_seen_disc = _ev_disc;
+
+	uint32_t now = millis();
+	if(WiFi.status() == WL_CONNECTED){
+		_state = CONNECTED; _state_ms = now;
+	} else {
+		_down_since = now;
+		startConnect_(now);
+	}
+}
+
+void WifiLink::beginSta(const char* ssid, const char* pass, uint8_t listen_interval){
+	if(!listen_interval){
+		WiFi.begin(ssid, pass);
+		return;
+	}
+	// 설정만 적용(connect=false)한 뒤 listen_interval을 넣고 연결
+	WiFi.begin(ssid, pass, 0, nullptr, false);
+	wifi_config_t conf;
+	if(esp_wifi_get_config(WIFI_IF_STA, &conf) == ESP_OK){
+		conf.sta.listen_interval = listen_interval;
+		esp_wifi_set_config(WIFI_IF_STA, &conf);
+	}
+	esp_wifi_connect();
+}
+
+void WifiLink::startConnect_(uint32_t now){
+	beginSta(_ssid, _pass, _listen);
+	_stats.attempts++;
+	_state = CONNECTING; _state_ms = now;
+}
+
+void WifiLink::enterBackoff_(uint32_t now){
+	uint32_t d = _backoff.next();
+	_retry_at = now + d;
+	_state = BACKOFF; _state_ms = now;
+	Serial.printf("[WiFi] retry #%u in %lu ms (reason %u)\n", _backoff.attempts(), (unsigned long)d, _stats.last_reason);
+}
+
+void WifiLink::loop(){
+	if(_state == IDLE) return;
+	uint32_t now = millis();
+
+	uint32_t got_ip = _ev_got_ip, disc = _ev_disc;
+	bool ev_up = (got_ip != _seen_got_ip);
+	bool ev_down = (disc != _seen_disc);
+	_seen_got_ip = got_ip; _seen_disc = disc;
+	if(ev_down) _stats.last_reason = _ev_reason;
+
+	switch(_state){
+		case CONNECTED:
+			if(ev_down && WiFi.status() != WL_CONNECTED){
+				_stats.disconnects++;
+				_down_since = now;
+				_backoff.reset();
+				Serial.printf("[WiFi] disconnected (reason %u)\n", _stats.last_reason);
+				enterBackoff_(now);
+			}
+			break;
+
+		case CONNECTING:
+			if(ev_up || WiFi.status() == WL_CONNECTED){
+				_stats.last_outage_ms = now - _down_since;
+				if(_stats.last_outage_ms > _stats.max_outage_ms) _stats.max_outage_ms = _stats.last_outage_ms;
+				_backoff.reset();
+				_state = CONNECTED; _state_ms = now;
+				Serial.printf("[WiFi] connected after %lu ms outage (%lu attempts total)\n",
+					(unsigned long)_stats.last_outage_ms, (unsigned long)_stats.attempts);
+			} else if(ev_down){
+				enterBackoff_(now);              // 시도 실패 (AP 없음/인증 실패 등)
+			} else if(now - _state_ms >= _timeout_ms){
+				WiFi.disconnect(false);          // 응답 없는 시도 중단 (이때 오는 DISCONNECTED는 BACKOFF에서 무시)
+				enterBackoff_(now);
+			}
+			break;
+
+		case BACKOFF:
+			if((int32_t)(now - _retry_at) >= 0) startConnect_(now);
+			break;
+
+		default:
+			break;
+	}
+}
+
+uint32_t WifiLink::outageMs() const {
+	return (_state == CONNECTED || _state == IDLE) ? 0 : millis() - _down_since;
+}
+
+const char* WifiLink::stateName() const {
+	switch(_state){
+		case CONNECTING: return "connecting";
+		case CONNECTED:  return "connected";
+		case BACKOFF:    return "backoff";
+		default:         return "idle";
+	}
+}
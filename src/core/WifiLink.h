@@ -0,0 +1,79 @@
+// =============================
+// File: core/WifiLink.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+
+// 지수 백오프 + 지터 (재연결 간격 계산용)
+// - next()를 부를 때마다 base_ms * 2^n (최대 max_ms)에 0~50% 랜덤 지터를 더해 반환합니다.
+// - 여러 노드가 AP/브로커 복구 직후 동시에 몰리지 않도록 지터를 넣습니다.
+class Backoff {
+	public:
+		Backoff(uint32_t base_ms=500, uint32_t max_ms=60000): _base(base_ms), _max(max_ms) {}
+		uint32_t next();
+		void reset(){ _n = 0; }
+		uint8_t attempts() const { return _n; }
+
+	private:
+		uint32_t _base, _max;
+		uint8_t  _n = 0;
+};
+
+// WiFi.onEvent 기반 비차단 Wi-Fi 연결 상태 머신
+// - 이벤트 콜백(WiFi 이벤트 Task)에서는 카운터만 올리고, 상태 전이는 loop()에서 처리합니다.
+// - loop()는 절대 대기하지 않으므로 mqttTask에서 매 반복 호출해도 됩니다.
+// - 재시도는 Backoff 간격으로만 수행하며, 단절 시간/재연결 횟수를 기록합니다.
+class WifiLink {
+	public:
+		enum State : uint8_t { IDLE, CONNECTING, CONNECTED, BACKOFF };
+
+		struct Stats {
+			uint32_t disconnects = 0;      // 연결 → 단절 횟수
+			uint32_t attempts = 0;         // WiFi.begin() 호출 횟수
+			uint32_t last_outage_ms = 0;   // 마지막 단절 ~ 재연결(GOT_IP)까지 걸린 시간
+			uint32_t max_outage_ms = 0;
+			uint8_t  last_reason = 0;      // 마지막 단절 사유 (wifi_err_reason_t)
+		};
+
+		void begin(const char* ssid, const char* pass, uint32_t connect_timeout_ms=15000);
+		void loop();
+
+		// 저전력: listen_interval > 0이면 모뎀 슬립(WIFI_PS_MAX_MODEM) + AP 비콘 listen_interval개마다 수신
+		// begin() 전에 호출. 리슨 인터벌은 연결(association) 시점에 AP와 협상되므로 다음 연결부터 적용
+		void setPowerSave(uint8_t listen_interval){ _listen = listen_interval; }
+		// STA 연결 시작 (listen_interval > 0이면 STA 설정에 반영 후 연결)
+		static void beginSta(const char* ssid, const char* pass, uint8_t listen_interval=0);
+
+		bool connected() const { return _state == CONNECTED; }
+		State state() const { return _state; }
+		const char* stateName() const;
+		const Stats& stats() const { return _stats; }
+		uint32_t outageMs() const;         // 현재 단절 지속 시간 (연결 중이면 0)
+
+	private:
+		static void onEvent_(WiFiEvent_t event, WiFiEventInfo_t info);
+		void startConnect_(uint32_t now);
+		void enterBackoff_(uint32_t now);
+
+		static WifiLink* s_self;
+
+		const char* _ssid = nullptr;
+		const char* _pass = nullptr;
+		uint32_t _timeout_ms = 15000;
+		uint8_t  _listen = 0;
+
+		State    _state = IDLE;
+		uint32_t _state_ms = 0;        // 현재 상태 진입 시각
+		uint32_t _retry_at = 0;        // BACKOFF 종료 시각
+		uint32_t _down_since = 0;      // 단절 시작 시각
+		Backoff  _backoff{500, 30000};
+		Stats    _stats;
+
+		// 이벤트 콜백 → loop() 전달용 (32비트 쓰기는 원자적)
+		volatile uint32_t _ev_got_ip = 0;
+		volatile uint32_t _ev_disc = 0;
+		volatile uint8_t  _ev_reason = 0;
+		uint32_t _seen_got_ip = 0;
+		uint32_t _seen_disc = 0;
+};
@@ -2,23 +2,169 @@
 // File: drivers/ADS1115_Helper.cpp
 // =============================
 #include "ADS1115_Helper.h"
+#include "../core/I2CBus.h"
+
+// 백그라운드 모드 데이터레이트 (250SPS = 4ms/변환)
+static constexpr uint16_t BG_DATA_RATE = RATE_ADS1115_250SPS;
 
 bool ADS1115_Helper::begin(uint8_t addr){
+    i2cbus::Guard bus(I2C_HZ_FAST);
     if(!_ads.begin(addr)) return false;
     _ads.setGain(GAIN_TWOTHIRDS); // ±6.144V → 0.1875mV/LSB
 
+    if(!_lock) _lock = xSemaphoreCreateMutex();
     return true;
 }
 
 int16_t ADS1115_Helper::read_raw(uint8_t ch) {
-    return _ads.readADC_SingleEnded(ch);
+    if(inBackground(ch)){
+        portENTER_CRITICAL(&_mux);
+        const Ring &r = _ring[ch];
+        int16_t v = r.count ? r.buf[(r.head + RING_LEN - 1) % RING_LEN] : 0;
+        bool have = r.count > 0;
+        portEXIT_CRITICAL(&_mux);
+        if(have) return v;
+    }
+
+    // 단발 변환: 백그라운드 변환과 겹치지 않도록 잠금 (RDY 알림은 백그라운드 Task 몫이라 타이머로 대기)
+    if(_lock) xSemaphoreTake(_lock, portMAX_DELAY);
+    int16_t raw = 0;
+    convert_(ch, false, raw);
+    if(_lock) xSemaphoreGive(_lock);
+    return raw;
 }
 
 float ADS1115_Helper::read_mV(uint8_t ch) {
-    int16_t raw = read_raw(ch);
-    return 2.0f * raw * 0.1875f; // x2 for your external divider
+    return raw_to_mV_(read_raw(ch));
+}
+
+float ADS1115_Helper::read_V(uint8_t ch) {
+    return read_mV(ch)/1000.0f;
+}
+
+// ===== 백그라운드 수집 =====
+bool ADS1115_Helper::startBackground(uint8_t ch_mask, uint16_t period_ms, int rdy_pin){
+    if(_task || !_lock) return false;
+    ch_mask &= (1u<<CH_COUNT) - 1;
+    if(!ch_mask) return false;
+
+    for(uint8_t i=0;i<CH_COUNT;i++){ _ring[i].head=0; _ring[i].count=0; _hampel[i].reset(); }
+    _mask = ch_mask; _period_ms = period_ms; _rdy_pin = rdy_pin; _stop = false;
+    _ads.setDataRate(BG_DATA_RATE);   // 레지스터 쓰기는 다음 변환 시작 시 반영 (I2C 접근 없음)
+
+    // Core 0, sensorTask보다 높은 우선순위 (대부분 대기 상태라 부하는 작음)
+    if(xTaskCreatePinnedToCore(taskEntry_, "ADS1115", 2048, this, 2, &_task, 0) != pdPASS){
+        _task = nullptr;
+        _ads.setDataRate(RATE_ADS1115_128SPS);
+        return false;
+    }
+    if(_rdy_pin >= 0){
+        pinMode(_rdy_pin, INPUT_PULLUP);
+        attachInterruptArg(digitalPinToInterrupt(_rdy_pin), rdyIsr_, this, FALLING);
+    }
+    return true;
+}
+
+void ADS1115_Helper::stopBackground(){
+    if(!_task) return;
+    _stop = true;
+    if(_rdy_pin >= 0) detachInterrupt(digitalPinToInterrupt(_rdy_pin));
+    while(_task) vTaskDelay(pdMS_TO_TICKS(1)); // 태스크가 스스로 종료할 때까지 대기
+    _ads.setDataRate(RATE_ADS1115_128SPS);
+}
+
+uint8_t ADS1115_Helper::samples(uint8_t ch) const {
+    return (ch < CH_COUNT) ? _ring[ch].count : 0;
+}
+
+float ADS1115_Helper::mean_mV(uint8_t ch, uint8_t n){
+    if(ch >= CH_COUNT) return NAN;
+    if(n > RING_LEN) n = RING_LEN;
+
+    // 최근 n개 샘플 합 (스파이크는 push_ 전에 Hampel이 걸러 두었으므로 절사 없이 평균)
+    int32_t sum = 0;
+    portENTER_CRITICAL(&_mux);
+    const Ring &r = _ring[ch];
+    if(n > r.count) n = r.count;
+    for(uint8_t i=0;i<n;i++) sum += r.buf[(r.head + RING_LEN - n + i) % RING_LEN];
+    portEXIT_CRITICAL(&_mux);
+
+    return n ? raw_to_mV_((float)sum / n) : NAN;
+}
+
+void ADS1115_Helper::push_(uint8_t ch, int16_t raw){
+    raw = _hampel[ch].update(raw);   // 링 잠금 밖에서 (백그라운드 Task만 접근)
+    portENTER_CRITICAL(&_mux);
+    Ring &r = _ring[ch];
+    r.buf[r.head] = raw;
+    r.head = (r.head + 1) % RING_LEN;
+    if(r.count < RING_LEN) r.count++;
+    portEXIT_CRITICAL(&_mux);
+}
+
+void IRAM_ATTR ADS1115_Helper::rdyIsr_(void *arg){
+    ADS1115_Helper *self = static_cast<ADS1115_Helper*>(arg);
+    BaseType_t woken = pdFALSE;
+    if(self->_task) vTaskNotifyGiveFromISR(self->_task, &woken);
+    if(woken) portYIELD_FROM_ISR();
+}
+
+// 현재 데이터레이트의 변환시간 (ms, 내부 발진기 오차 10% + 1ms)
+uint32_t ADS1115_Helper::convMs_(){
+    static const uint16_t SPS[8] = { 8, 16, 32, 64, 128, 250, 475, 860 };
+    return 1100u / SPS[(_ads.getDataRate() >> 5) & 7] + 1;
+}
+
+// 단발 변환 1회: 시작 → 완료 대기 (RDY 인터럽트 | 변환시간 후 OS 비트 확인) → 결과 읽기
+// I2C 버스는 레지스터 접근 순간에만 점유 (변환 대기 중에는 다른 장치가 사용)
+// 타이머 대기는 틱 경계에 따라 일찍 깰 수 있어 OS 비트로 완료를 확인합니다.
+// 완료되지 않은 채 결과를 읽으면 이전(다른 채널) 변환값이므로 false를 반환합니다.
+bool ADS1115_Helper::convert_(uint8_t ch, bool rdy, int16_t &raw){
+    if(rdy) ulTaskNotifyTake(pdTRUE, 0);   // 남은 알림 정리
+    {
+        i2cbus::Guard bus(I2C_HZ_FAST);
+        _ads.startADCReading(MUX_BY_CHANNEL[ch], /*continuous=*/false);
+    }
+
+    bool done = false;
+    if(rdy){
+        done = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(convMs_() * 4)) > 0;
+    } else {
+        vTaskDelay(pdMS_TO_TICKS(convMs_()));
+        for(uint8_t i=0; i<4; i++){
+            {
+                i2cbus::Guard bus(I2C_HZ_FAST);
+                done = _ads.conversionComplete();
+            }
+            if(done) break;
+            vTaskDelay(1);
+        }
+    }
+    if(!done) return false;
+
+    i2cbus::Guard bus(I2C_HZ_FAST);
+    raw = _ads.getLastConversionResults();
+    return true;
 }
 
-float ADS1115_Helper::read_V(uint8_t ch) { 
-    return read_mV(ch)/1000.0f; 
-}
\ No newline at end of file
+void ADS1115_Helper::taskEntry_(void *arg){
+    static_cast<ADS1115_Helper*>(arg)->taskLoop_();
+}
+
+void ADS1115_Helper::taskLoop_(){
+    const bool rdy = _rdy_pin >= 0;
+    while(!_stop){
+        for(uint8_t ch=0; ch<CH_COUNT && !_stop; ch++){
+            if(!(_mask & (1u<<ch))) continue;
+
+            int16_t raw;
+            xSemaphoreTake(_lock, portMAX_DELAY);
+            bool ok = convert_(ch, rdy, raw);
+            xSemaphoreGive(_lock);
+            if(ok) push_(ch, raw);
+        }
+        vTaskDelay(pdMS_TO_TICKS(_period_ms));
+    }
+    _task = nullptr;
+    vTaskDelete(NULL);
+}
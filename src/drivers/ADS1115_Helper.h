@@ -4,16 +4,63 @@
 #pragma once
 #include <Arduino.h>
 #include <Adafruit_ADS1X15.h>
-
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "../core/Filters.h"
 
 class ADS1115_Helper {
     public:
+        static constexpr uint8_t  CH_COUNT = 4;
+        // 채널별 보관 샘플 수. 백그라운드는 채널마다 단발 변환(250SPS)을 1회씩 돌고 period_ms 쉬므로
+        // 채널당 주기 ≈ 채널 수 × 변환 1회(RDY 약 4.3ms / 타이머 약 5.2ms, I2C 포함) + period_ms
+        // → 기본 3채널, period_ms=10 이면 약 23~26ms (채널당 약 40Hz), 링 32개 ≈ 최근 0.8초
+        static constexpr uint8_t  RING_LEN = 32;
+        // 링에 넣기 전 채널별 Hampel 필터 (최근 HAMPEL_LEN개 중앙값 ± 3 × 1.4826 × MAD 밖의 단발 스파이크를 중앙값으로 대체)
+        // 실제 계단 변화는 창의 절반이 새 값으로 찰 때(채널당 약 4샘플 ≈ 0.1초)부터 그대로 통과합니다.
+        static constexpr uint8_t  HAMPEL_LEN = 7;
+
         bool begin(uint8_t addr=0x48);
         float read_mV(uint8_t ch); // accounting your x2 divider on inputs
         float read_V(uint8_t ch);
         int16_t read_raw(uint8_t ch);
         Adafruit_ADS1115& dev(){ return _ads; }
 
+        // ===== 백그라운드 수집 =====
+        // ch_mask 채널들을 단발(single-shot) 변환으로 순회하여 채널별 링 버퍼에 저장합니다.
+        // 단발 변환은 MUX 설정 직후의 첫 결과가 유효하므로 채널 전환 시 버리는 변환이 없습니다.
+        // rdy_pin >= 0 이면 ALERT/RDY 핀 인터럽트로, 아니면 변환시간 타이머로 페이싱합니다.
+        // 백그라운드 채널에 대한 read_mV()/read_raw()는 I2C 없이 최신 샘플을 반환합니다.
+        bool startBackground(uint8_t ch_mask, uint16_t period_ms=10, int rdy_pin=-1);
+        void stopBackground();
+        bool background() const { return _task != nullptr; }
+        TaskHandle_t task() const { return _task; }
+        bool inBackground(uint8_t ch) const { return _task && ch < CH_COUNT && (_mask & (1u<<ch)); }
+
+        uint8_t samples(uint8_t ch) const;                 // 링에 쌓인 샘플 수 (최대 RING_LEN)
+        float mean_mV(uint8_t ch, uint8_t n=10);            // 최근 n개 (Hampel 통과) 샘플 평균, 없으면 NAN
+        float mean_V(uint8_t ch, uint8_t n=10){ return mean_mV(ch, n)/1000.0f; }
+
     private:
+        static float raw_to_mV_(float raw){ return 2.0f * raw * 0.1875f; } // x2 for your external divider
+        static void taskEntry_(void *arg);
+        static void IRAM_ATTR rdyIsr_(void *arg);
+        void taskLoop_();
+        uint32_t convMs_();
+        bool convert_(uint8_t ch, bool rdy, int16_t &raw);
+        void push_(uint8_t ch, int16_t raw);
+
         Adafruit_ADS1115 _ads;
-};
\ No newline at end of file
+
+        // 백그라운드 상태
+        struct Ring { int16_t buf[RING_LEN]; uint8_t head=0; uint8_t count=0; };
+        Ring _ring[CH_COUNT];
+        filt::Hampel<HAMPEL_LEN, int16_t> _hampel[CH_COUNT];   // 백그라운드 Task 전용
+        portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;   // 링 버퍼 보호
+        SemaphoreHandle_t _lock = nullptr;                  // I2C 변환 설정 보호 (백그라운드 ↔ 단발 읽기)
+        TaskHandle_t _task = nullptr;
+        volatile bool _stop = false;
+        uint8_t  _mask = 0;
+        uint16_t _period_ms = 10;
+        int      _rdy_pin = -1;
+};
@@ -2,9 +2,16 @@
 // File: drivers/BME68X.cpp
 // =============================
 #include "BME68X.h"
+#include "../core/I2CBus.h"
 
+// 기본 스캔 프로파일: 100~400°C 상승 후 하강 (단계당 히터 100ms, 10단계 ≈ 1.6초)
+const BME68X::HeaterStep BME68X::DEFAULT_PROFILE[BME68X::PROFILE_MAX] = {
+	{100,100}, {150,100}, {200,100}, {250,100}, {300,100},
+	{350,100}, {400,100}, {350,100}, {300,100}, {250,100},
+};
 
 bool BME68X::begin(uint8_t addr){
+	i2cbus::Guard bus(I2C_HZ_FAST);
 	if(!_bme.begin(addr)) return false;
 
 	_bme.setTemperatureOversampling(BME680_OS_8X);
@@ -17,13 +24,83 @@ bool BME68X::begin(uint8_t addr){
 }
 
 
+bool BME68X::startReading(){
+	if(_busy) return true;
+	unsigned long end_ms;
+	{
+		i2cbus::Guard bus(I2C_HZ_FAST);   // 측정 시작 명령만 보내고 버스 반환
+		if(_prof_n){
+			_bme.setGasHeater(_prof[_step].temp_c, _prof[_step].dur_ms);
+		} else {
+			// 저전력: gas_every번에 1번만 히터 사용 (히터 발열이 온도 측정을 왜곡하지 않도록)
+			bool gas = (_gas_every <= 1) || (_meas_n % _gas_every == 0);
+			_meas_n++;
+			if(gas != _heater_on || _heater_dirty){
+				if(gas) _bme.setGasHeater(320,150);
+				else    _bme.setGasHeater(0,0);      // 히터/가스 측정 끔
+				_heater_on = gas;
+				_heater_dirty = false;
+			}
+		}
+		end_ms = _bme.beginReading();
+	}
+	if(end_ms == 0) return false;
+	_ready_at = (uint32_t)end_ms;
+	_busy = true;
+	return true;
+}
+
+uint32_t BME68X::remainingMs() const {
+	if(!_busy) return 0;
+	int32_t left = (int32_t)(_ready_at - millis());
+	return left > 0 ? (uint32_t)left : 0;
+}
+
+bool BME68X::collect(float &t, float &h, float &g){
+	if(!_busy) return false;
+	_busy = false;
+	i2cbus::Guard bus(I2C_HZ_FAST);
+	if(!_bme.endReading()){
+		_step = 0;   // 스캔 중 실패: 벡터가 섞이지 않도록 처음부터 다시
+		return false;
+	}
+
+	_last_t = t = _bme.temperature; 
+	_last_h = h = _bme.humidity; 
+	g = (_prof_n || _heater_on) ? _bme.gas_resistance : 0.0f;   // 히터를 끈 측정은 가스 값 없음(0)
+	if(g > 0) _last_gas_res = g;
+
+	if(_prof_n){
+		_scan[_step] = g * 0.001f;
+		if(++_step >= _prof_n){
+			memcpy(_done, _scan, _prof_n * sizeof(float));
+			_done_n = _prof_n;
+			_step = 0;
+		}
+	}
+	return true;
+}
+
+void BME68X::setProfile(const HeaterStep* steps, uint8_t n){
+	if(n > PROFILE_MAX) n = PROFILE_MAX;
+	if(n) memcpy(_prof, steps, n * sizeof(HeaterStep));
+	else if(_prof_n) _heater_dirty = true;
+	_prof_n = n;
+	_step = 0;
+	_done_n = 0;
+}
+
+uint8_t BME68X::takeScan(float* out_kohm){
+	uint8_t n = _done_n;
+	if(n) memcpy(out_kohm, _done, n * sizeof(float));
+	_done_n = 0;
+	return n;
+}
+
 bool BME68X::read(float &t, float &h, float &g){
-	if(!_bme.performReading()) 
+	if(!startReading()) 
 		return false; 
-	
-	t=_bme.temperature; 
-	h=_bme.humidity; 
-	_last_gas_res = g = _bme.gas_resistance;
-	
-	return true;
+	uint32_t left = remainingMs();
+	if(left) delay(left);
+	return collect(t, h, g);
 }
\ No newline at end of file
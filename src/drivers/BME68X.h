@@ -6,12 +6,65 @@
 #include <Adafruit_BME680.h>
 
 
+// 측정은 두 단계로 나뉩니다. (히터 동작 중 버스/Task를 막지 않도록)
+//   startReading() → 변환 시작, 완료 예정 시각(readyAt) 기록
+//   remainingMs()  → 0이 될 때까지 다른 일 수행
+//   collect()      → 결과 읽기 (완료 전에 부르면 남은 시간만큼 대기)
+// read()는 위 과정을 한 번에 수행하는 차단형 호출입니다. (교정/포털용)
+//
+// 히터 프로파일 스캔: setProfile()로 (온도, 시간) 단계를 지정하면 측정마다 다음 단계로 히터를 바꾸고,
+// 한 바퀴가 끝나면 단계별 가스 저항 벡터(가스 지문)를 takeScan()으로 꺼낼 수 있습니다.
 class BME68X {
 	public:
+		struct HeaterStep { uint16_t temp_c; uint16_t dur_ms; };
+		static constexpr uint8_t PROFILE_MAX = 10;
+		static const HeaterStep DEFAULT_PROFILE[PROFILE_MAX];
+
 		bool begin(uint8_t addr=0x76);
 		bool read(float &tempC, float &hum, float &gas_ohm);
+
+		bool startReading();
+		bool busy() const { return _busy; }
+		uint32_t readyAt() const { return _ready_at; }     // millis() 기준 완료 예정 시각
+		uint32_t remainingMs() const;
+		bool collect(float &tempC, float &hum, float &gas_ohm);
+
+		// n=0이면 고정 히터(320°C/150ms)로 복귀. 다음 startReading()부터 적용
+		void setProfile(const HeaterStep* steps, uint8_t n);
+		bool scanning() const { return _prof_n > 0; }
+		// 고정 히터 모드에서 n번 측정에 1번만 히터를 켬 (1 = 매번, 기본). 나머지 측정은 온도/습도만
+		void setGasEvery(uint8_t n){ _gas_every = n ? n : 1; }
+		uint8_t scanStep() const { return _step; }          // 다음 측정할 단계 (0이면 새 스캔 시작)
+		// 완료된 스캔 벡터(kOhm)를 1회 복사하고 원소 수 반환. 새 스캔이 없으면 0
+		uint8_t takeScan(float* out_kohm);
+
 		float last_gas_resistance() const { return _last_gas_res; }
+		// 마지막 성공 측정의 온도/습도 (측정 전에는 NAN)
+		float last_temperature() const { return _last_t; }
+		float last_humidity() const { return _last_h; }
+
+		// 재부팅 간 이어 쓰기용 마지막 측정값 (core/WarmState.h)
+		struct WarmState { float gas_res, t, h; };
+		void saveState(WarmState &s) const { s.gas_res=_last_gas_res; s.t=_last_t; s.h=_last_h; }
+		bool restoreState(const WarmState &s){
+			if(!(s.gas_res > 0)) return false;
+			_last_gas_res=s.gas_res; _last_t=s.t; _last_h=s.h;
+			return true;
+		}
 	private:
 		Adafruit_BME680 _bme;
+		HeaterStep _prof[PROFILE_MAX];
+		uint8_t _prof_n = 0;
+		uint8_t _step = 0;
+		bool _heater_dirty = false;   // 스캔 종료 후 고정 히터 설정 복원 필요
+		bool _heater_on = true;       // 고정 히터 모드에서 현재 히터 설정 (begin()에서 켬)
+		uint8_t _gas_every = 1;
+		uint32_t _meas_n = 0;
+		float _scan[PROFILE_MAX];     // 진행 중인 스캔
+		float _done[PROFILE_MAX];     // 완료된 스캔
+		uint8_t _done_n = 0;
+		bool _busy = false;
+		uint32_t _ready_at = 0;
 		float _last_gas_res = -1.0f; // 마지막 가스 저항 값 저장, 초기값 -1
-};
\ No newline at end of file
+		float _last_t = NAN, _last_h = NAN;
+};
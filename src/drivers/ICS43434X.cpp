@@ -4,6 +4,10 @@
 #include "ICS43434X.h"
 #include <math.h>
 
+namespace {
+    constexpr float FULL_SCALE = 8388608.0f;   // 2^23 (24비트)
+}
+
 
 bool ICS43434X::begin(int bclk, int lrck, int din, int fs){
     i2s_config_t cfg = {
@@ -17,27 +21,125 @@ bool ICS43434X::begin(int bclk, int lrck, int din, int fs){
     .communication_format = (i2s_comm_format_t)(I2S_COMM_FORMAT_I2S | I2S_COMM_FORMAT_I2S_MSB),
     #endif
     .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-    .dma_buf_count = 4,
-    .dma_buf_len = 256,
+    .dma_buf_count = 8,                // 8 x 256 샘플 = 16kHz에서 128ms 여유 (reader Task 지연 흡수)
+    .dma_buf_len = (int)DMA_LEN,
     .use_apll = false,
     .tx_desc_auto_clear = false,
     .fixed_mclk = 0
     };
     i2s_pin_config_t pins = { .bck_io_num=bclk, .ws_io_num=lrck, .data_out_num=-1, .data_in_num=din };
-    if(i2s_driver_install(_port, &cfg, 0, NULL)!=ESP_OK) return false; i2s_set_pin(_port, &pins); i2s_zero_dma_buffer(_port); return true;
-}
-
-
-float ICS43434X::read_rms(){
-    int32_t buf[1024]; 
-    size_t br=0; 
-    float acc=0; 
-    
-    i2s_read(_port, (void*)buf, sizeof(buf), &br, portMAX_DELAY); 
-    size_t n=br/sizeof(int32_t); if(!n) return 0; 
-    for(size_t i=0;i<n;i++){ 
-        float v=(float)(buf[i]>>8); 
-        acc+=v*v;
-    } 
-    return sqrtf(acc/n);
-}
\ No newline at end of file
+    if(i2s_driver_install(_port, &cfg, 0, NULL)!=ESP_OK) return false; i2s_set_pin(_port, &pins); i2s_zero_dma_buffer(_port);
+    _fs = fs;
+    designAWeighting_((float)fs, _aw);
+    return true;
+}
+
+// IEC 61672 A가중 아날로그 필터 (극점 20.6/107.7/737.9/12194 Hz)를 1차 인자별 쌍선형 변환으로 3개 biquad로 구성
+//   s/(s+w) → K(1 - z^-1) / ((K+w) + (w-K) z^-1),  1/(s+w) → (1 + z^-1) / ((K+w) + (w-K) z^-1),  K = 2fs
+// 1 kHz 이득을 0 dB로 맞춥니다. (fs=16kHz에서는 4kHz 이상 고역이 다소 낮게 나옴)
+void ICS43434X::designAWeighting_(float fs, filt::Biquad *bq){
+    const float K = 2.0f * fs;
+    const float w1 = 2.0f * (float)M_PI * 20.598997f;
+    const float w2 = 2.0f * (float)M_PI * 107.65265f;
+    const float w3 = 2.0f * (float)M_PI * 737.86223f;
+    const float w4 = 2.0f * (float)M_PI * 12194.217f;
+
+    // 1차 인자 두 개 (n0 + n1 z^-1)/(d0 + d1 z^-1)의 곱 → biquad
+    auto pair = [](filt::Biquad &b, float na0, float na1, float da0, float da1,
+                                    float nb0, float nb1, float db0, float db1){
+        float a0 = da0 * db0;
+        b.set(na0 * nb0 / a0, (na0 * nb1 + na1 * nb0) / a0, na1 * nb1 / a0,
+              (da0 * db1 + da1 * db0) / a0, da1 * db1 / a0);
+    };
+    pair(bq[0], K, -K, K + w1, w1 - K,  K, -K, K + w1, w1 - K);   // s^2 / (s+w1)^2
+    pair(bq[1], K, -K, K + w2, w2 - K,  K, -K, K + w3, w3 - K);   // s^2 / ((s+w2)(s+w3))
+    pair(bq[2], 1,  1, K + w4, w4 - K,  1,  1, K + w4, w4 - K);   // 1 / (s+w4)^2
+
+    float g = bq[0].gainAt(1000.0f, fs) * bq[1].gainAt(1000.0f, fs) * bq[2].gainAt(1000.0f, fs);
+    if(g > 0.0f) bq[0].scale(1.0f / g);
+    for(uint8_t i = 0; i < 3; i++) bq[i].reset();
+}
+
+bool ICS43434X::startTask(uint16_t window_ms, uint8_t leq_windows, UBaseType_t prio, BaseType_t core){
+    if(_task) return false;
+    if(!window_ms) window_ms = 1000;
+    _win_len = (uint32_t)_fs * window_ms / 1000;
+    if(_win_len < DMA_LEN) _win_len = DMA_LEN;
+    _leq_len = constrain(leq_windows, 1, LEQ_WINDOWS_MAX);
+    _win_n = 0; _win_sq = _win_asq = 0; _win_peak = 0;
+    _leq_sum = 0; _leq_head = _leq_count = 0;
+
+    // 대부분 i2s_read 대기 상태라 부하는 작음 (16kHz에서 256샘플마다 1회 깨어남)
+    if(xTaskCreatePinnedToCore(taskEntry_, "MIC", 3072, this, prio, &_task, core) != pdPASS){
+        _task = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void ICS43434X::taskEntry_(void *arg){
+    static_cast<ICS43434X*>(arg)->taskLoop_();
+}
+
+void ICS43434X::taskLoop_(){
+    const float inv_full = 1.0f / FULL_SCALE;
+    for(;;){
+        size_t br = 0;
+        if(i2s_read(_port, (void*)_buf, sizeof(_buf), &br, pdMS_TO_TICKS(1000)) != ESP_OK || br == 0) continue;
+        size_t n = br / sizeof(int32_t);
+
+        // 블록 단위 float 누적 후 구간 합(double)에 더함 (정밀도 유지 + double 연산 최소화)
+        float sq = 0, asq = 0, peak = _win_peak;
+        for(size_t i = 0; i < n; i++){
+            float x = (float)(_buf[i] >> 8) * inv_full;
+            float ax = fabsf(x);
+            if(ax > peak) peak = ax;
+            sq += x * x;
+            float a = _aw[2].update(_aw[1].update(_aw[0].update(x)));
+            asq += a * a;
+        }
+        _win_sq += sq; _win_asq += asq; _win_peak = peak;
+        _win_n += n;
+        _samples += n;
+        if(_win_n >= _win_len) finishWindow_();
+    }
+}
+
+void ICS43434X::finishWindow_(){
+    float e = (float)(_win_asq / _win_n);
+    float rms = sqrtf((float)(_win_sq / _win_n)) * FULL_SCALE;
+
+    // 긴 구간 Leq: 구간 길이가 같으므로 구간 평균 에너지의 평균
+    if(_leq_count == _leq_len) _leq_sum -= _leq_e[_leq_head];
+    else _leq_count++;
+    _leq_e[_leq_head] = e;
+    _leq_sum += e;
+    _leq_head = (_leq_head + 1) % _leq_len;
+    float e_long = (float)(_leq_sum / _leq_count);
+
+    Levels lv;
+    lv.rms = rms;
+    lv.peak = _win_peak * FULL_SCALE;
+    lv.laeq = (e > 0.0f) ? 10.0f * log10f(e) + DBFS_TO_SPL : NAN;
+    lv.laeq_long = (e_long > 0.0f) ? 10.0f * log10f(e_long) + DBFS_TO_SPL : NAN;
+    lv.ms = millis();
+
+    portENTER_CRITICAL(&_mux);
+    lv.seq = _lv.seq + 1;
+    _lv = lv;
+    portEXIT_CRITICAL(&_mux);
+
+    _win_n = 0; _win_sq = _win_asq = 0; _win_peak = 0;
+}
+
+bool ICS43434X::levels(Levels &out, uint32_t max_age_ms) const {
+    portENTER_CRITICAL(&_mux);
+    out = _lv;
+    portEXIT_CRITICAL(&_mux);
+    return out.seq != 0 && (millis() - out.ms) <= max_age_ms;
+}
+
+float ICS43434X::read_rms() const {
+    Levels lv;
+    return levels(lv) ? lv.rms : NAN;
+}
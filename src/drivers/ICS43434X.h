@@ -4,12 +4,65 @@
 #pragma once
 #include <Arduino.h>
 #include <driver/i2s.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../core/Filters.h"
 
 
+// ICS43434 I2S 마이크
+// startTask() 후에는 전용 Task가 DMA 버퍼를 계속 비우면서 window_ms 구간마다
+// RMS/피크/A가중 Leq를 계산하고, 최근 leq_windows개 구간의 에너지 평균으로 긴 구간 Leq를 갱신합니다.
+// 읽는 쪽(levels/read_rms)은 I2S를 건드리지 않고 최신 집계값만 복사합니다.
 class ICS43434X {
 	public:
+		// 감도 -26 dBFS @ 94 dB SPL → dB SPL = dBFS + 120 (24비트 풀스케일 기준)
+		static constexpr float DBFS_TO_SPL = 120.0f;
+		static constexpr uint8_t LEQ_WINDOWS_MAX = 60;
+		static constexpr size_t  DMA_LEN = 256;        // DMA 버퍼 1개 샘플 수 (= 1회 읽기 단위)
+
+		struct Levels {
+			float    rms = NAN;         // 구간 비가중 RMS (24비트 원시값 단위, 기존 mic_rms와 동일)
+			float    peak = NAN;        // 구간 최대 |샘플| (24비트 원시값 단위)
+			float    laeq = NAN;        // 구간 A가중 Leq [dB SPL]
+			float    laeq_long = NAN;   // 최근 leq_windows 구간 A가중 Leq [dB SPL]
+			uint32_t seq = 0;           // 구간 완료 횟수 (0이면 아직 없음)
+			uint32_t ms = 0;            // 마지막 구간 완료 시각
+		};
+
 		bool begin(int bclk, int lrck, int din, int fs=16000);
-		float read_rms();
+		bool startTask(uint16_t window_ms=1000, uint8_t leq_windows=60, UBaseType_t prio=2, BaseType_t core=0);
+		bool running() const { return _task != nullptr; }
+		TaskHandle_t task() const { return _task; }
+
+		// 최신 집계값 복사. 아직 구간이 없거나 max_age_ms보다 오래되었으면 false
+		bool levels(Levels &out, uint32_t max_age_ms=UINT32_MAX) const;
+		// 최근 구간 RMS (대기 없음). Task 미시작/구간 없음이면 NAN
+		float read_rms() const;
+		uint32_t samples() const { return _samples; }   // 누적 처리 샘플 수
+
 	private:
-		i2s_port_t _port=I2S_NUM_0; size_t _n=1024;
-};
\ No newline at end of file
+		static void taskEntry_(void *arg);
+		void taskLoop_();
+		void finishWindow_();
+		static void designAWeighting_(float fs, filt::Biquad *bq);
+
+		i2s_port_t _port=I2S_NUM_0;
+		int        _fs = 16000;
+		TaskHandle_t _task = nullptr;
+
+		// Task 전용 상태
+		int32_t      _buf[DMA_LEN];
+		filt::Biquad _aw[3];                 // A가중 필터 (3단 직렬)
+		uint32_t     _win_len = 16000;       // 구간 샘플 수
+		uint32_t     _win_n = 0;
+		double       _win_sq = 0, _win_asq = 0;
+		float        _win_peak = 0;
+		float        _leq_e[LEQ_WINDOWS_MAX];  // 구간별 A가중 평균 에너지
+		double       _leq_sum = 0;
+		uint8_t      _leq_len = 60, _leq_head = 0, _leq_count = 0;
+		volatile uint32_t _samples = 0;
+
+		// 공개 집계값
+		Levels _lv;
+		mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+};
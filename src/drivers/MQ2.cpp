@@ -5,7 +5,8 @@
 
 
 void MQ2::begin(const MQ2Config &cfg, float r0_value){
-	_cfg=cfg; _t0=millis(); _ema=NAN; _alarm=false; _count=0;
+	_cfg=cfg; _t0=millis(); _alarm=false; _count=0;
+	_ema.reset(); _ema.setAlpha(cfg.ema_alpha);
 
 	// 외부에서 유효한 R0 값을 제공하면, 교정 단계를 건너뛰고 바로 RUN 상태로 시작
 	if (r0_value > 0.0f) {
@@ -38,7 +39,7 @@ void MQ2::update_from_adc_mV(float adc_mV){
 		case CALIB:
 			_r0 += _rs; _count++;
 			if(now - _t0 >= _cfg.calib_s*1000UL){
-			if(_count>0) _r0 /= (float)_count; if(_r0 < 100.0f) _r0 = 100.0f; _ph = RUN; _ema = 1.0f; _t0=now;
+			if(_count>0) _r0 /= (float)_count; if(_r0 < 100.0f) _r0 = 100.0f; _ph = RUN; _ema.set(1.0f); _t0=now;
 			}
 			break;
 		case RUN:
@@ -48,8 +49,17 @@ void MQ2::update_from_adc_mV(float adc_mV){
 
 	if(!isnan(_r0) && _r0>0){
 		_ratio = _rs/_r0;
-		if(isnan(_ema)) _ema=_ratio;
-		_ema = (1.0f-_cfg.ema_alpha)*_ema + _cfg.ema_alpha*_ratio;
-		_alarm = (_ph==RUN) && (_ema < _cfg.alarm_thr);
+		if(!_ema.ready()) _ema.set(_ratio);
+		_ema.update(_ratio);
+		_alarm = (_ph==RUN) && (_ema.value() < _cfg.alarm_thr);
 	}
+}
+
+// RUN 상태 스냅샷만 적용. R0는 begin()에 준 값(NVS 교정값)이 있으면 그대로 유지
+bool MQ2::restoreState(const WarmState &s){
+	if(s.phase != RUN || !(s.r0 > 0.0f) || isnan(s.ema)) return false;
+	if(isnan(_r0) || _r0 <= 0.0f) _r0 = s.r0;
+	_ema.set(s.ema);
+	_ph = RUN; _t0 = millis();
+	return true;
 }
\ No newline at end of file
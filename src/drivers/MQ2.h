@@ -3,6 +3,7 @@
 // =============================
 #pragma once
 #include <Arduino.h>
+#include "../core/Filters.h"
 
 
 struct MQ2Config {
@@ -28,10 +29,16 @@ class MQ2 {
 		float r0() const { return _r0; }
 		float rs() const { return _rs; }
 		float ratio() const { return _ratio; }
-		float ratio_ema() const { return _ema; }
+		float ratio_ema() const { return _ema.ready() ? _ema.value() : NAN; }
 		bool alarm() const { return _alarm; }
 		float calc_Rs_from_AO_mV_(float v_adc_mV) const; // using divider, RL, Vs
+
+		// 재부팅 간 이어 쓰기용 필터 상태 (core/WarmState.h)
+		struct WarmState { float r0, ema; uint8_t phase; };
+		void saveState(WarmState &s) const { s.r0=_r0; s.ema=ratio_ema(); s.phase=(uint8_t)_ph; }
+		bool restoreState(const WarmState &s);
 	private:
 		MQ2Config _cfg; Phase _ph=WARMUP; uint32_t _t0=0;
-		float _r0=NAN, _rs=NAN, _ratio=NAN, _ema=NAN; bool _alarm=false; uint32_t _count=0;
+		float _r0=NAN, _rs=NAN, _ratio=NAN; bool _alarm=false; uint32_t _count=0;
+		filt::Ema<float> _ema;
 };
\ No newline at end of file
@@ -3,13 +3,25 @@
 // =============================
 #pragma once
 #include <Arduino.h>
+#include "../core/UartFrame.h"
 
 struct PM25Data { uint16_t pm1_0, pm2_5, pm10; };
 
+// 프레임: 42 4D LEN(2, =28) DATA(26) CS(2, 앞 30바이트 합)
+inline bool sen0177_frame_valid(const uint8_t *f){
+	uint16_t len=(f[2]<<8)|f[3]; if(len!=28) return false;
+	uint16_t sum=0; for(int i=0;i<30;i++) sum+=f[i]; return sum==(uint16_t)((f[30]<<8)|f[31]);
+}
+
 class SEN0177 {
 	public:
+		typedef UartFrame<0x42, 0x4D, 32, sen0177_frame_valid> Rx;
+
 		bool begin(HardwareSerial &ser, int rxPin, int txPin, uint32_t baud=9600);
-		bool read(PM25Data &out);
+		// 수신 콜백이 보관한 최신 프레임으로 변환 (대기 없음). max_age_ms보다 오래된 프레임은 무시
+		bool read(PM25Data &out, uint32_t max_age_ms=3000);
+		const Rx& rx() const { return _rx; }
 	private:
 		HardwareSerial *_ser=nullptr;
+		Rx _rx;
 };
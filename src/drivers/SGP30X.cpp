@@ -2,12 +2,56 @@
 // File: drivers/SGP30X.cpp
 // =============================
 #include "SGP30X.h"
+#include "../core/I2CBus.h"
 
 
 bool SGP30X::begin(){ 
-	if(!_sgp.begin()) return false; _sgp.IAQinit(); return true; 
+	i2cbus::Guard bus(I2C_HZ_FAST);
+	if(!_sgp.begin()) return false; _sgp.IAQinit(); 
+	_restored = false; _base_from_ms = millis(); _base_saved_ms = 0;
+	return true; 
 }
 
 bool SGP30X::read(uint16_t &eco2, uint16_t &tvoc){ 
+	i2cbus::Guard bus(I2C_HZ_FAST);
 	if(!_sgp.IAQmeasure()) return false; eco2=_sgp.eCO2; tvoc=_sgp.TVOC; return true; 
-}
\ No newline at end of file
+}
+
+// 복원은 IAQinit 직후에 해야 하므로 다시 초기화한 뒤 기준선 설정
+bool SGP30X::restoreBaseline(uint16_t eco2_base, uint16_t tvoc_base){
+	if(eco2_base == 0 || tvoc_base == 0) return false;
+	i2cbus::Guard bus(I2C_HZ_FAST);
+	if(!_sgp.IAQinit() || !_sgp.setIAQBaseline(eco2_base, tvoc_base)) return false;
+	if(_ah_mg) _sgp.setHumidity(_ah_mg);    // IAQinit이 습도 보정을 해제하므로 다시 설정
+	_restored = true;
+	_base_from_ms = millis(); _base_saved_ms = 0;
+	return true;
+}
+
+bool SGP30X::baselineDue(uint16_t &eco2_base, uint16_t &tvoc_base){
+	uint32_t now = millis();
+	if(_base_saved_ms){
+		if(now - _base_saved_ms < BASELINE_INTERVAL_MS) return false;
+	} else if(now - _base_from_ms < (_restored ? BASELINE_INTERVAL_MS : BASELINE_FIRST_MS)){
+		return false;
+	}
+	i2cbus::Guard bus(I2C_HZ_FAST);
+	if(!_sgp.getIAQBaseline(&eco2_base, &tvoc_base)) return false;
+	_base_saved_ms = now ? now : 1;
+	return true;
+}
+
+bool SGP30X::setAbsHumidity(float g_m3){
+	if(!isfinite(g_m3) || g_m3 < 0) return false;
+	uint32_t mg = (uint32_t)lroundf(g_m3 * 1000.0f);
+	if(mg > 256000) mg = 256000;                           // 센서 입력 범위 (8.8 고정소수점 g/m^3)
+	if(mg / 100 == _ah_mg / 100) return true;             // 0.1 g/m^3 미만 변화는 무시
+	i2cbus::Guard bus(I2C_HZ_FAST);
+	if(!_sgp.setHumidity(mg)) return false;
+	_ah_mg = mg;
+	return true;
+}
+
+float SGP30X::absHumidity(float t, float rh){
+	return 216.7f * ((rh / 100.0f) * 6.112f * expf((17.62f * t) / (243.12f + t)) / (273.15f + t));
+}
@@ -6,10 +6,32 @@
 #include <Adafruit_SGP30.h>
 
 
+// 기준선(baseline) 관리 (Sensirion SGP30 데이터시트 권장 절차)
+// - 재부팅 후 저장된 기준선이 7일 이내면 restoreBaseline()으로 복원 → 재학습(수 시간) 없이 바로 유효
+// - 처음 시작한 센서는 12시간 동작 후부터, 복원한 경우 1시간 후부터 매시간 baselineDue()가 저장할 값을 돌려줌
+// - 저장 매체(NVS)는 호출 측이 담당합니다.
+// 습도 보정: setAbsHumidity()에 절대습도(g/m^3)를 주면 센서 내부 보정에 사용
 class SGP30X {
 	public:
+		static constexpr uint32_t BASELINE_MAX_AGE_S   = 7UL * 24 * 3600;
+		static constexpr uint32_t BASELINE_FIRST_MS    = 12UL * 3600 * 1000;
+		static constexpr uint32_t BASELINE_INTERVAL_MS = 3600UL * 1000;
+
 		bool begin();
 		bool read(uint16_t &eco2, uint16_t &tvoc);
+
+		bool restoreBaseline(uint16_t eco2_base, uint16_t tvoc_base);
+		bool restored() const { return _restored; }
+		bool baselineDue(uint16_t &eco2_base, uint16_t &tvoc_base);
+
+		bool setAbsHumidity(float g_m3);
+		// 온도(°C)/상대습도(%) → 절대습도(g/m^3), Magnus 식
+		static float absHumidity(float temp_c, float rh);
+
 	private:
 		Adafruit_SGP30 _sgp;
-};
\ No newline at end of file
+		bool     _restored = false;
+		uint32_t _base_from_ms = 0;    // 기준선 학습 시작 시각 (IAQinit 또는 복원)
+		uint32_t _base_saved_ms = 0;   // 마지막 저장 시각 (0 = 아직 없음)
+		uint32_t _ah_mg = 0;           // 마지막으로 설정한 절대습도 (mg/m^3)
+};
@@ -2,9 +2,11 @@
 // File: drivers/SMOKE2.cpp
 // =============================
 #include "SMOKE2.h"
+#include "../core/I2CBus.h"
 
 // ===== Low-level I2C =====
 bool SMOKE2::writeReg16(uint8_t reg, uint16_t val){
+	i2cbus::Guard bus(I2C_HZ_FAST);
 	_w->beginTransmission(_addr);
 	_w->write(reg);
 	_w->write(uint8_t(val>>8));
@@ -13,6 +15,7 @@ bool SMOKE2::writeReg16(uint8_t reg, uint16_t val){
 }
 
 bool SMOKE2::readReg16(uint8_t reg, uint16_t &out){
+	i2cbus::Guard bus(I2C_HZ_FAST);
 	_w->beginTransmission(_addr);
 	_w->write(reg);
 	if(_w->endTransmission(false)!=0) return false;             // repeated start
@@ -22,44 +25,90 @@ bool SMOKE2::readReg16(uint8_t reg, uint16_t &out){
 	return true;
 }
 
-// 8바이트(4워드) 버스트 읽기: stop true/false 모두 시도 후 폴백
-bool SMOKE2::readFIFOWords(uint16_t* buf, size_t words){
-	const uint8_t need = words * 2;
-
-	// try #1: sendStop=false
-	_w->beginTransmission(_addr);
-	_w->write(REG_FIFO_DATA);
-	if (_w->endTransmission(false) == 0) {
-		int got = _w->requestFrom((uint8_t)_addr, need, (uint8_t)false);
-		if (got == need) {
-		for (size_t i=0;i<words;++i){
-			int msb=_w->read(), lsb=_w->read();
-			if (msb<0 || lsb<0) return false;
-			buf[i] = (uint16_t(uint8_t(msb))<<8) | uint8_t(lsb);
+// FIFO 버스트 읽기 1회 시도
+//  - BURST_NOSTOP : 레지스터 주소 후 repeated start, 읽기 후 stop 없음
+//  - BURST_STOP   : 읽기 후 stop
+//  - BURST_WORDS  : 16비트씩 개별 트랜잭션 (폴백)
+bool SMOKE2::burstTry_(BurstMode m, uint8_t* buf, size_t bytes){
+	if(m == BURST_WORDS){
+		for(size_t i=0;i<bytes/2;++i){
+			uint16_t w=0;
+			if(!readReg16(REG_FIFO_DATA, w)) return false;
+			buf[2*i]=uint8_t(w>>8); buf[2*i+1]=uint8_t(w&0xFF);
 		}
 		return true;
-		}
 	}
 
-	// try #2: sendStop=true
+	i2cbus::Guard bus(I2C_HZ_FAST);
 	_w->beginTransmission(_addr);
 	_w->write(REG_FIFO_DATA);
-	if (_w->endTransmission(false) == 0) {
-		int got = _w->requestFrom((uint8_t)_addr, need, (uint8_t)true);
-		if (got == need) {
-		for (size_t i=0;i<words;++i){
-			int msb=_w->read(), lsb=_w->read();
-			if (msb<0 || lsb<0) return false;
-			buf[i] = (uint16_t(uint8_t(msb))<<8) | uint8_t(lsb);
-		}
-		return true;
+	if (_w->endTransmission(false) != 0) return false;
+	int got = _w->requestFrom((uint8_t)_addr, (uint8_t)bytes, (uint8_t)(m == BURST_STOP));
+	if (got != (int)bytes) return false;
+	for (size_t i=0;i<bytes;++i){
+		int b=_w->read();
+		if (b<0) return false;
+		buf[i]=uint8_t(b);
+	}
+	return true;
+}
+
+// FIFO 버스트 읽기 (최대 FIFO_BYTES). 처음 성공한 방식을 기억하여 이후에는 그 방식만 사용
+bool SMOKE2::readFIFOBytes(uint8_t* buf, size_t bytes){
+	if(bytes > FIFO_BYTES) bytes = FIFO_BYTES;
+	if(_burst != BURST_UNKNOWN){
+		if(burstTry_(_burst, buf, bytes)) return true;
+		_burst = BURST_UNKNOWN; // 캐시된 방식 실패 → 다음 호출에서 다시 탐색
+		return false;
+	}
+	for(uint8_t m=BURST_NOSTOP; m<=BURST_WORDS; ++m){
+		if(burstTry_((BurstMode)m, buf, bytes)){
+			_burst = (BurstMode)m;
+			#if SMOKE2_DEBUG
+			Serial.printf("[SMOKE2] FIFO burst mode=%u\n", _burst);
+			#endif
+			return true;
 		}
 	}
+	return false;
+}
 
-	// try #3: 16비트씩 폴백
-	for(size_t i=0;i<words;++i){
-		if(!readReg16(REG_FIFO_DATA, buf[i])) return false;
+bool SMOKE2::readFIFOWords(uint16_t* buf, size_t words){
+	uint8_t raw[FIFO_BYTES];
+	if(!readFIFOBytes(raw, words*2)) return false;
+	for(size_t i=0;i<words && i<FIFO_BYTES/2;++i) buf[i]=(uint16_t(raw[2*i])<<8) | raw[2*i+1];
+	return true;
+}
+
+// ===== FIFO 워터마크 인터럽트 =====
+void IRAM_ATTR SMOKE2::isr_(void* arg){
+	SMOKE2* self = (SMOKE2*)arg;
+	self->_irq_pending = true;
+	if(self->_notify){
+		BaseType_t hp = pdFALSE;
+		vTaskNotifyGiveFromISR(self->_notify, &hp);
+		if(hp) portYIELD_FROM_ISR();
 	}
+}
+
+bool SMOKE2::enableFifoInterrupt(int int_pin, TaskHandle_t notify){
+	if(!_w || int_pin < 0) return false;
+	_notify = notify;
+
+	// FIFO 워드 수가 임계값을 "초과"하면 인터럽트 → 패킷 N개(4워드/패킷)에서 발생하도록 N*4-1
+	uint16_t thresh_words = uint16_t(_packets_to_avg) * (PACKET_BYTES/2) - 1;
+	bool ok = writeReg16(REG_MODE, 0x0001);                 // PROGRAM 모드에서 설정
+	ok = ok && writeReg16(REG_FIFO_THRESH, uint16_t(thresh_words << 8));
+	ok = ok && writeReg16(REG_INT_MASK, 0x00FF);            // FIFO 인터럽트만 사용 (Slot A/B 인터럽트 마스크)
+	ok = ok && writeReg16(REG_GPIO_CTRL, 0x0000);           // GPIO0 = 인터럽트 출력
+	ok = ok && writeReg16(REG_GPIO_DRV, 0x0004);            // GPIO0 활성, push-pull, active high
+	writeReg16(REG_MODE, 0x0002);                           // NORMAL (샘플링 재개)
+	if(!ok) return false;
+
+	pinMode(int_pin, INPUT);
+	_int_pin = int_pin;
+	_irq_pending = true; // 이미 쌓여 있는 패킷도 한 번 비우도록
+	attachInterruptArg(digitalPinToInterrupt(int_pin), isr_, this, RISING);
 	return true;
 }
 
@@ -182,12 +231,13 @@ bool SMOKE2::begin(TwoWire &w, uint8_t i2c_addr, float precal_alpha){
 	_cal_ready=false; _endian_fixed=false; _use_ba=true;
 
 	if (precal_alpha > 0.0f) {
-		_ema_ratio = precal_alpha;
+		_ema.set(precal_alpha);
 		_baseline_ready = true;
 		_samples_seen = _warmup_samples; // 예열 단계를 건너뛰었음을 표시
 	} else {
-		_samples_seen=0; _baseline_ready=false; _ema_ratio=0.f;
+		_samples_seen=0; _baseline_ready=false; _ema.reset();
 	}
+	i2cbus::Guard bus(I2C_HZ_FAST);   // 초기화 레지스터 시퀀스 전체를 한 번에
 	adpd_init();
 	delay(10);
 	#if SMOKE2_DEBUG
@@ -197,25 +247,33 @@ bool SMOKE2::begin(TwoWire &w, uint8_t i2c_addr, float precal_alpha){
 }
 
 // ===== Read & process =====
-bool SMOKE2::read(Reading &out){
+// FIFO에 쌓인 패킷을 버스트 1회로 비우고 샘플마다 process_() 실행. 처리한 샘플 수 반환
+uint8_t SMOKE2::drain_(){
+	if(_recal_req) resetBaseline_();   // 샘플 처리 문맥에서만 기준선을 건드림
+
+	uint8_t raw[FIFO_BYTES];
+	uint8_t npk=0;
+	{
+	// 상태 확인 ~ 버스트 읽기 사이에 다른 장치가 끼어들지 않도록 버스를 한 번에 점유
+	i2cbus::Guard bus(I2C_HZ_FAST);
 	// FIFO 상태
 	uint16_t status=0;
-	if(!readReg16(REG_STATUS_FIFO,status)) return false;
+	if(!readReg16(REG_STATUS_FIFO,status)) return 0;
 	uint8_t fifo_bytes=(status>>8)&0xFF;
-	const uint8_t PACKET_BYTES=8;
-	if(fifo_bytes<PACKET_BYTES) return false;
-
-	// 여러 패킷 평균
-	uint8_t can=fifo_bytes/PACKET_BYTES;
-	uint8_t navg = can < _packets_to_avg ? can : _packets_to_avg;
-	if(navg==0) navg=1;
-
-	uint64_t accB=0, accIR=0;
-	uint8_t nread = 0;
+	if(fifo_bytes>=FIFO_BYTES) _fifo_overflows++;   // 비우기 전에 가득 참 (일부 샘플 유실 가능)
+
+	// 쌓인 패킷을 I2C 버스트 1회로 모두 비움 (최대 FIFO_MAX_PACKETS)
+	npk = fifo_bytes/PACKET_BYTES;
+	if(npk>FIFO_MAX_PACKETS) npk=FIFO_MAX_PACKETS;
+	_irq_pending = false; // 비우는 동안 새 워터마크 에지가 오면 다시 설정됨
+	if(npk==0) return 0;
+	if(!readFIFOBytes(raw, npk*PACKET_BYTES)) return 0;
+	}
 
-	for(uint8_t i=0;i<navg;i++){
+	for(uint8_t p=0;p<npk;p++){
+		const uint8_t* pk = raw + p*PACKET_BYTES;
 		uint16_t w[4];
-		if(!readFIFOWords(w,4)) break;
+		for(uint8_t k=0;k<4;k++) w[k]=(uint16_t(pk[2*k])<<8) | pk[2*k+1];
 
 		if(!_endian_fixed){
 		uint32_t Aab=(uint32_t(w[0])<<16)|w[1], Aba=(uint32_t(w[1])<<16)|w[0];
@@ -233,45 +291,37 @@ bool SMOKE2::read(Reading &out){
 
 		uint32_t blue = _use_ba ? ((uint32_t(w[1])<<16)|w[0]) : ((uint32_t(w[0])<<16)|w[1]);
 		uint32_t ir   = _use_ba ? ((uint32_t(w[3])<<16)|w[2]) : ((uint32_t(w[2])<<16)|w[3]);
-
-		accB += blue;
-		accIR += ir;
-		nread++;
+		process_(blue, ir);
 	}
-	if(nread==0) return false;
-
-	uint32_t blue = uint32_t(accB / nread);
-	uint32_t ir   = uint32_t(accIR / nread);
-
-	out.raw_blue = blue;
-	out.raw_ir   = ir;
-	out.navg     = nread;
+	return npk;
+}
 
+// 샘플 1개: ratio/alpha(EMA)/score/퍼시스턴스 갱신 후 구간 집계에 누적
+void SMOKE2::process_(uint32_t blue, uint32_t ir){
 	// === eFuse 보정 정규화 (선택) ===
 	float blue_n = _cal_ready ? (float(blue) / _gcal_blue) : float(blue);
 	float ir_n   = _cal_ready ? (float(ir)   / _gcal_ir)   : float(ir);
 
 	// ratio/alpha
 	float ratio_now = (ir_n>0) ? (blue_n/ir_n) : 0.0f;
-	out.alpha_updated = false;
+	bool alpha_updated = false;
 
 	if(_samples_seen < _warmup_samples){
 		_samples_seen++;
-		_ema_ratio = (_samples_seen==1) ? ratio_now
-										: (1.f-_ema_alpha)*_ema_ratio + _ema_alpha*ratio_now;
-		out.alpha_updated = true;
+		_ema.update(ratio_now);   // 첫 샘플로 초기화
+		alpha_updated = true;
 		if(_samples_seen>=_warmup_samples) _baseline_ready=true;
 	} else {
 		if(!_alpha_locked){
-		float delta=fabsf(ratio_now-_ema_ratio);
+		float delta=fabsf(ratio_now-_ema.value());
 		if(delta < _adapt_guard){ // 이벤트 중에는 업데이트 정지 효과
-			_ema_ratio = (1.f-_ema_alpha)*_ema_ratio + _ema_alpha*ratio_now;
-			out.alpha_updated = true;
+			_ema.update(ratio_now);
+			alpha_updated = true;
 		}
 		}
 	}
 
-	float alpha = (_ema_ratio>0.f)? _ema_ratio : 0.02f;
+	float alpha = (_ema.value()>0.f)? _ema.value() : 0.02f;
 
 	// score = ±(ratio - alpha) * IR_eff  (투과형이면 부호 반전)
 	// IR 값으로 스케일링하여 score의 범위를 안정화시킵니다.
@@ -283,28 +333,120 @@ bool SMOKE2::read(Reading &out){
 	float core = (ratio_now - alpha) * 1000000.0f;
 	float score = _transmissive ? -core : core;
 
-	// 퍼시스턴스 + 히스테리시스(OFF 쪽 느리게)
+	// 퍼시스턴스 + 히스테리시스(OFF 쪽 느리게), 샘플 단위로 계수
 	bool on_now = _baseline_ready && (score > _th_score);
 	if(on_now){ _cnt_on++; _cnt_off=0; } else { _cnt_off++; _cnt_on=0; }
-	if(!_alarm_state && _cnt_on  >= _persist_on)  _alarm_state=true;
+	if(!_alarm_state && _cnt_on  >= _persist_on){
+		_alarm_state=true;
+		_alarm_edge=true;
+		if(_alarm_notify) xTaskNotifyGive(_alarm_notify);
+	}
 	if( _alarm_state && _cnt_off >= _persist_off) _alarm_state=false;
 
-	// 결과
-	out.blue=blue; out.ir=ir; out.ratio=ratio_now; out.alpha=alpha;
-	out.score=score; out.alarm=_alarm_state; out.ir_eff=ir_eff;
+	// 구간 집계
+	portENTER_CRITICAL(&_mux);
+	if(_agg.n==0 || score>_agg.score_max) _agg.score_max=score;
+	if(_agg.n<255){ _agg.n++; _agg.sum_blue+=blue; _agg.sum_ir+=ir; }
+	_agg.ratio=ratio_now; _agg.alpha=alpha; _agg.ir_eff=ir_eff;
+	_agg.alarm = _agg.alarm || _alarm_state;
+	_agg.alpha_updated = _agg.alpha_updated || alpha_updated;
+	portEXIT_CRITICAL(&_mux);
+}
+
+// 재교정: 예열부터 다시 (칩 설정/eFuse 보정/엔디안 판별은 유지)
+void SMOKE2::resetBaseline_(){
+	_samples_seen=0; _baseline_ready=false; _ema.reset();
+	_cnt_on=0; _cnt_off=0; _alarm_state=false;
+	portENTER_CRITICAL(&_mux);
+	_agg=Agg();
+	portEXIT_CRITICAL(&_mux);
+	_recal_req=false;
+}
+
+void SMOKE2::saveState(WarmState &s) const {
+	s.ema_ratio=_ema.value(); s.samples_seen=_samples_seen;
+	s.baseline_ready=_baseline_ready; s.endian_fixed=_endian_fixed; s.use_ba=_use_ba; s.burst=_burst;
+}
+
+bool SMOKE2::restoreState(const WarmState &s){
+	if(!s.baseline_ready || !(s.ema_ratio > 0.f)) return false;
+	_ema.set(s.ema_ratio);
+	_samples_seen = s.samples_seen > _warmup_samples ? s.samples_seen : _warmup_samples;
+	_baseline_ready=true;
+	_endian_fixed=s.endian_fixed; _use_ba=s.use_ba;
+	if(s.burst <= BURST_WORDS) _burst=(BurstMode)s.burst;
+	return true;
+}
+
+void SMOKE2::toReading_(const Agg &a, Reading &out) const {
+	uint32_t blue = uint32_t(a.sum_blue / a.n);
+	uint32_t ir   = uint32_t(a.sum_ir / a.n);
+
+	out.raw_blue=blue; out.raw_ir=ir; out.navg=a.n;
+	out.blue=blue; out.ir=ir; out.ratio=a.ratio; out.alpha=a.alpha;
+	out.score=a.score_max; out.alarm=a.alarm || _alarm_state; out.ir_eff=a.ir_eff;
+	out.alpha_updated=a.alpha_updated;
+}
+
+bool SMOKE2::peek(Reading &out) const {
+	Agg a;
+	portENTER_CRITICAL(&_mux);
+	a=_agg;
+	if(a.n==0) out=_last;
+	portEXIT_CRITICAL(&_mux);
+	if(a.n==0) return out.navg>0;
+	toReading_(a, out);
+	return true;
+}
+
+bool SMOKE2::read(Reading &out){
+	// 전용 Task가 없으면 호출 시점에 FIFO를 비움 (인터럽트 모드에서는 워터마크 전까지 I2C 접근 없음)
+	poll();
+
+	Agg a;
+	portENTER_CRITICAL(&_mux);
+	a=_agg; _agg=Agg();
+	portEXIT_CRITICAL(&_mux);
+	if(a.n==0) return false;
+
+	toReading_(a, out);
+	portENTER_CRITICAL(&_mux);
+	_last=out;
+	portEXIT_CRITICAL(&_mux);
 
 	#if SMOKE2_DEBUG
 	static uint32_t lastLog=0; uint32_t now=millis();
 	if(now-lastLog>500){
 		lastLog=now;
 		Serial.printf("[SMOKE2] B=%u IR=%u r=%.5f a=%.5f s=%.0f navg=%u upd=%d alarm=%d\n",
-					blue, ir, ratio_now, alpha, score, out.navg, out.alpha_updated, out.alarm);
+					(unsigned)out.blue, (unsigned)out.ir, out.ratio, out.alpha, out.score, out.navg, out.alpha_updated, out.alarm);
 	}
 	#endif
 
 	return true;
 }
 
+// ===== 샘플 단위 처리 Task =====
+void SMOKE2::taskEntry_(void* arg){
+	SMOKE2* self = static_cast<SMOKE2*>(arg);
+	for(;;){
+		if(self->_int_pin >= 0) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)); // 워터마크 대기 (놓친 에지 대비 1초 타임아웃)
+		else                    vTaskDelay(pdMS_TO_TICKS(self->_poll_ms));
+		self->drain_();
+	}
+}
+
+bool SMOKE2::startTask(UBaseType_t prio, BaseType_t core, uint16_t poll_ms){
+	if(_task || !_w) return false;
+	_poll_ms = poll_ms ? poll_ms : 125;
+	if(xTaskCreatePinnedToCore(taskEntry_, "SMOKE2", 3072, this, prio, &_task, core) != pdPASS){
+		_task = nullptr;
+		return false;
+	}
+	if(_int_pin >= 0) _notify = _task;   // 워터마크 인터럽트 → Task 깨움
+	return true;
+}
+
 // ===== Diagnostics =====
 bool SMOKE2::checkMapping(){
 	uint16_t v=0; if(!readReg16(REG_SLOT_SEL,v)) return false;
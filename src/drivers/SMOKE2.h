@@ -4,17 +4,22 @@
 #pragma once
 #include <Arduino.h>
 #include <Wire.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../core/Filters.h"
 
 #define SMOKE2_DEBUG 0   // 초기화/읽기 진단 로그 활성화
 
 class SMOKE2 {
 public:
+  // 샘플(16Hz)마다 판정한 결과를 직전 read() 이후 구간으로 집계한 값
   struct Reading {
-    uint32_t blue=0, ir=0;        // 평균된 원시 합계(정규화 전)
-    float    ratio=0, alpha=0, score=0;
-    bool     alarm=false;
-    uint8_t  navg=0;              // 이번에 평균된 패킷 수
-    bool     alpha_updated=false; // 이번 사이클에 alpha 갱신 여부
+    uint32_t blue=0, ir=0;        // 구간 평균 원시 합계(정규화 전)
+    float    ratio=0, alpha=0;    // 마지막 샘플 기준
+    float    score=0;             // 구간 최대 score
+    bool     alarm=false;         // 현재 경보이거나 구간 중 한 번이라도 경보
+    uint8_t  navg=0;              // 구간에 포함된 샘플 수
+    bool     alpha_updated=false; // 구간 중 alpha 갱신 여부
     float    ir_eff=0;            // score 계산에 사용된 IR 하한 보정값
     uint32_t raw_blue=0, raw_ir=0;// 내부 확인용
   };
@@ -23,16 +28,27 @@ public:
   void setAddr(uint8_t a=0x64){ _addr=a; }
   void setSampleHz(uint16_t hz=16){ _sample_hz=hz; _warmup_samples = _sample_hz * _warmup_sec; }
   void setWarmupSec(uint16_t s=15){ _warmup_sec=s; _warmup_samples = _sample_hz * _warmup_sec; }
-  void setEmaAlpha(float a=0.01f){ _ema_alpha=a; }
+  void setEmaAlpha(float a=0.01f){ _ema.setAlpha(a); }
   void setThreshold(float th=1.0e5f){ _th_score=th; }
-  void setPacketsToAvg(uint8_t n){ _packets_to_avg = n<1?1:(n>8?8:n); }
+  // FIFO 워터마크(패킷 수). 인터럽트 모드에서 이 개수가 쌓이면 GPIO0이 올라갑니다.
+  void setPacketsToAvg(uint8_t n){ _packets_to_avg = n<1?1:(n>FIFO_MAX_PACKETS?FIFO_MAX_PACKETS:n); }
   void setAdaptGuard(float g=0.02f){ _adapt_guard=g; }     // ratio 변화 2% 이내만 alpha 갱신
   void freezeAlpha(bool on){ _alpha_locked=on; }
   void setMinIrForScaling(float v=2000.f){ _min_ir_for_scaling=v; }
+  // 경보 퍼시스턴스 (샘플 수 기준, 16Hz에서 1샘플 ≈ 62ms)
   void setPersist(uint16_t onN=3, uint16_t offN=5){ _persist_on=onN; _persist_off=offN; }
-  float getAlpha() const { return _ema_ratio; }
+  float getAlpha() const { return _ema.value(); }
 
   bool isBaselineReady() const { return _baseline_ready; }
+
+  // 재부팅 간 이어 쓰기용 기준선/판별 상태 (core/WarmState.h). restoreState()는 begin() 후, startTask() 전에 호출
+  struct WarmState {
+    float    ema_ratio;
+    uint32_t samples_seen;
+    uint8_t  baseline_ready, endian_fixed, use_ba, burst;
+  };
+  void saveState(WarmState &s) const;
+  bool restoreState(const WarmState &s);
   // LED/TIA/적분시간 튜닝값(필요 시 begin() 전에 호출)
   void setLedBlueReg(uint16_t v){ _reg_led1_drv=v; }
   void setLedIrReg(uint16_t v){ _reg_led3_drv=v; }
@@ -51,8 +67,37 @@ public:
   // ===== 수명주기 =====
   bool begin(TwoWire &w, uint8_t i2c_addr); // 이전 버전 호환성을 위한 선언 추가
   bool begin(TwoWire &w=Wire, uint8_t i2c_addr=0x64, float precal_alpha = 0.0f);
+  // 직전 호출 이후 샘플들의 집계 결과. 전용 Task가 없으면 여기서 FIFO를 비우고 샘플별로 처리
   bool read(Reading &out);
+  // 구간 집계를 소비하지 않고 조회 (상태 페이지 등). 구간이 비어 있으면 마지막 read() 결과
+  bool peek(Reading &out) const;
+  // 전용 Task 없이 쓸 때 FIFO(16패킷 ≈ 1초)가 차기 전에 주기적으로 호출. Task가 있으면 아무 일도 안 함
+  uint8_t poll(){ return (!_task && fifoPending()) ? drain_() : 0; }
+
+  // 기준선(alpha) 재교정 요청. 예열/기준선 초기화는 FIFO를 비우는 쪽(Task 또는 poll/read)이 다음 처리 때 수행
+  void requestRecalibrate(){ _recal_req = true; }
+  // 재교정 요청 후 새 기준선이 준비될 때까지 true
+  bool recalibrating() const { return _recal_req || !_baseline_ready; }
+
+  // ===== 샘플 단위 처리 Task =====
+  // FIFO를 비우고 샘플마다 ratio/EMA/score/퍼시스턴스를 계산하는 전용 Task (높은 우선순위 권장)
+  // 인터럽트 모드면 워터마크마다 깨어나고, 아니면 poll_ms마다 FIFO를 확인합니다.
+  bool startTask(UBaseType_t prio=3, BaseType_t core=0, uint16_t poll_ms=125);
+  bool taskRunning() const { return _task != nullptr; }
+  TaskHandle_t task() const { return _task; }
+  // 경보가 켜지는 순간 notify Task에 xTaskNotifyGive (발행 경로를 즉시 깨우기 위함)
+  void setAlarmNotify(TaskHandle_t t){ _alarm_notify = t; }
+  bool alarm() const { return _alarm_state; }
+  // 마지막 호출 이후 경보 상승 에지가 있었는지 (읽으면 해제)
+  bool takeAlarmEdge(){ bool e = _alarm_edge; _alarm_edge = false; return e; }
 
+  // ===== FIFO 워터마크 인터럽트 =====
+  // GPIO0을 FIFO 임계 인터럽트로 설정하고 int_pin의 상승 에지를 받습니다. (begin() 후 호출)
+  // notify를 주면 인터럽트마다 해당 Task에 vTaskNotifyGiveFromISR을 보냅니다.
+  bool enableFifoInterrupt(int int_pin, TaskHandle_t notify=nullptr);
+  // 읽을 패킷이 있을 가능성 (인터럽트 모드: 워터마크 도달 후 아직 비우지 않음 / 폴링 모드: 항상 true)
+  bool fifoPending() const { return _int_pin < 0 || _irq_pending; }
+  uint32_t fifoOverflows() const { return _fifo_overflows; }   // 비우기 전에 FIFO가 가득 찬 횟수
   // 진단
   bool checkMapping();           // Blue->A, IR->B ?
   void dumpKeyRegs(Stream& s);   // 주요 레지스터 값 출력
@@ -65,7 +110,6 @@ private:
   uint8_t  _addr=0x64;
   uint16_t _sample_hz=16;
   uint16_t _warmup_sec=15;
-  float    _ema_alpha=0.01f;
   uint16_t _warmup_samples=16*15;
   float    _th_score=1.0e5f;
 
@@ -74,12 +118,14 @@ private:
   bool     _alpha_locked=false;
   float    _min_ir_for_scaling=2000.f;
   uint16_t _persist_on=3,_persist_off=5;
-  bool     _alarm_state=false;
+  volatile bool _alarm_state=false;
+  volatile bool _alarm_edge=false;
   uint16_t _cnt_on=0,_cnt_off=0;
 
   uint32_t _samples_seen=0;
   bool     _baseline_ready=false;
-  float    _ema_ratio=0.f;
+  volatile bool _recal_req=false;
+  filt::Ema<float> _ema{0.01f};  // 기준 ratio(alpha) 추적 EMA
 
   // 레지스터 튜닝 값(기본: 권장치)
   uint16_t _reg_led1_drv=0x3536; // BLUE
@@ -107,7 +153,43 @@ private:
   bool writeReg16(uint8_t reg, uint16_t val);
   bool readReg16(uint8_t reg, uint16_t &out);
   bool readFIFOWords(uint16_t* buf, size_t words); // burst read
+  bool readFIFOBytes(uint8_t* buf, size_t bytes);   // 버스트 1회 (성공한 방식을 기억)
+
+  // FIFO 버스트 읽기 방식 (처음 성공한 방식을 캐시하여 이후 재탐색하지 않음)
+  enum BurstMode : uint8_t { BURST_UNKNOWN, BURST_NOSTOP, BURST_STOP, BURST_WORDS };
+  BurstMode _burst = BURST_UNKNOWN;
+  bool burstTry_(BurstMode m, uint8_t* buf, size_t bytes);
+
+  static constexpr uint8_t PACKET_BYTES = 8;          // Slot A/B 각 32비트
+  static constexpr uint8_t FIFO_BYTES = 128;          // ADPD188 FIFO 깊이 (= Wire 버퍼)
+  static constexpr uint8_t FIFO_MAX_PACKETS = FIFO_BYTES / PACKET_BYTES;
+
+  // 샘플 처리 & 구간 집계
+  uint8_t drain_();                                  // FIFO 비우기 → 샘플마다 process_(), 처리한 샘플 수
+  void process_(uint32_t blue, uint32_t ir);
+  void resetBaseline_();
+  struct Agg {
+    uint8_t  n=0;
+    uint64_t sum_blue=0, sum_ir=0;
+    float    ratio=0, alpha=0, score_max=0, ir_eff=0;
+    bool     alarm=false, alpha_updated=false;
+  } _agg;
+  Reading _last;                                     // 마지막 read() 결과 (peek()용)
+  mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+  void toReading_(const Agg &a, Reading &out) const;
+
+  // 전용 Task
+  static void taskEntry_(void* arg);
+  TaskHandle_t _task = nullptr;
+  TaskHandle_t _alarm_notify = nullptr;
+  uint16_t _poll_ms = 125;
 
+  // 인터럽트
+  static void IRAM_ATTR isr_(void* arg);
+  int      _int_pin = -1;
+  volatile bool _irq_pending = false;
+  TaskHandle_t _notify = nullptr;
+  uint32_t _fifo_overflows = 0;
   // ===== 칩 초기화 & eFuse =====
   void adpd_init();
   bool efuse_enable();
@@ -118,6 +200,10 @@ private:
   // ===== 레지스터 맵 (데이터시트 일치) =====
   enum : uint8_t {
     REG_STATUS_FIFO=0x00,  // [15:8] FIFO bytes
+    REG_INT_MASK=0x01,     // [8] FIFO_INT_MASK (0=사용)
+    REG_GPIO_DRV=0x02,     // [2] GPIO0_ENA, [1] GPIO0_DRV, [0] GPIO0_POL
+    REG_FIFO_THRESH=0x06,  // [13:8] FIFO 워드 수 > 임계 시 인터럽트
+    REG_GPIO_CTRL=0x0B,    // [4:0] GPIO0_ALT_CFG (0=인터럽트 출력)
 	REG_DEVID=0x08,
 	REG_SW_RESET=0x0F,
     REG_MODE=0x10,
@@ -2,6 +2,7 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include <SensirionI2cSps30.h>
+#include "../core/I2CBus.h"
 
 // --- 출력 포맷 매크로 정규화: FLOAT 이름이 없으면 값으로 보정 ---
 #if defined(SPS30_OUTPUT_FORMAT_FLOAT)
@@ -16,7 +17,9 @@
 class SPS30X {
 	public:
 		// 기본 I2C 주소 0x69
+		// SPS30은 최대 100kHz → 접근할 때마다 I2C_HZ_SPS30으로 전환
 		bool begin(TwoWire& w = Wire, uint8_t i2c_addr = 0x69) {
+			i2cbus::Guard bus(I2C_HZ_SPS30);
 			_wire = &w;
 			_sps.begin(*_wire, i2c_addr);
 
@@ -35,6 +38,7 @@ class SPS30X {
 		// μg/m³를 uint16로 반환(반올림/클램프). 성공 시 true
 		bool read(uint16_t& pm1_0, uint16_t& pm2_5, uint16_t& pm4_0, uint16_t& pm10) {
 			if (!_started) return false;
+			i2cbus::Guard bus(I2C_HZ_SPS30);
 			//const uint32_t now = millis();
 			//if (now - _lastReadMs < 900) return false; // 1초 간격 권장
 
@@ -68,9 +72,31 @@ class SPS30X {
 			return true;
 		}
 
+		// 저전력 듀티 사이클: 팬/레이저 정지 후 슬립 (깨운 뒤 측정값 안정화까지 수십 초 필요)
+		bool sleep() {
+			if (!_started) return false;
+			i2cbus::Guard bus(I2C_HZ_SPS30);
+			_sps.stopMeasurement(); delay(5);
+			if (_sps.sleep()) return false;
+			_started = false; _asleep = true;
+			return true;
+		}
+
+		bool wake() {
+			if (!_asleep) return _started;
+			i2cbus::Guard bus(I2C_HZ_SPS30);
+			_sps.wakeUpSequence(); delay(5);
+			if (_sps.startMeasurement(SPS30X_FMT_FLOAT)) return false;
+			_asleep = false; _started = true;
+			return true;
+		}
+
+		bool asleep() const { return _asleep; }
+
 	private:
 		SensirionI2cSps30 _sps;
 		TwoWire* _wire = nullptr;
 		bool _started = false;
+		bool _asleep = false;
 		uint32_t _lastReadMs = 0;
 };
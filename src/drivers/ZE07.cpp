@@ -5,7 +5,9 @@
 
 
 bool ZE07::begin(HardwareSerial &ser, int rxPin, int txPin, uint32_t baud){
-	_ser=&ser; _ser->begin(baud, SERIAL_8N1, rxPin, txPin); return true;
+	_ser=&ser; _ser->begin(baud, SERIAL_8N1, rxPin, txPin);
+	_rx.attach(*_ser); // 바이트는 UART 이벤트 Task에서 프레임 단위로 조립
+	return true;
 }
 
 
@@ -16,18 +18,9 @@ void ZE07::setQA(bool qa_mode){
 }
 
 
-bool ZE07::read_frame(uint32_t timeout_ms){
-	if(!_ser) return false; uint32_t st=millis();
-
-	while(millis()-st < timeout_ms){
-		if(_ser->available()){
-			uint8_t b=(uint8_t)_ser->read(); if(b!=0xFF) continue; _frame[0]=b;
-			int idx=1; while(idx<9 && (millis()-st<timeout_ms)) if(_ser->available()) _frame[idx++]=(uint8_t)_ser->read();
-			if(idx==9){ return checksum_(_frame)==_frame[8]; }
-			break;
-		}
-	}
-	return false;
+bool ZE07::latest_frame(uint32_t max_age_ms){
+	if(!_ser) return false;
+	return _rx.latest(_frame, max_age_ms);
 }
 
 
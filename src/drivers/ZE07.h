@@ -3,15 +3,22 @@
 // =============================
 #pragma once
 #include <Arduino.h>
+#include "../core/UartFrame.h"
 
+// 능동 업로드 프레임: FF 04 03 01 HH LL FH FL CS (CS = 1~7 바이트 합의 2의 보수)
+inline bool ze07_frame_valid(const uint8_t *f){ uint8_t s=0; for(int i=1;i<=7;++i) s+=f[i]; return (uint8_t)((~s)+1)==f[8]; }
 
 class ZE07 {
 	public:
+		typedef UartFrame<0xFF, -1, 9, ze07_frame_valid> Rx;
+
 		bool begin(HardwareSerial &ser, int rxPin, int txPin, uint32_t baud=9600);
-		bool read_frame(uint32_t timeout_ms=200);
+		// 수신 콜백이 보관한 최신 프레임 조회 (대기 없음). max_age_ms보다 오래된 프레임은 무시
+		bool latest_frame(uint32_t max_age_ms=2000);
 		bool parse_ppm(float &ppm, uint16_t &full_range_ppm, uint8_t &decimals) const;
 		void setQA(bool qa_mode);
+		const Rx& rx() const { return _rx; }
 	private:
 		HardwareSerial *_ser=nullptr; uint8_t _frame[9]{}; bool _qa=false;
-		static uint8_t checksum_(const uint8_t *buf){ uint8_t s=0; for(int i=1;i<=7;++i) s+=buf[i]; return (uint8_t)((~s)+1);}
-};
\ No newline at end of file
+		Rx _rx;
+};
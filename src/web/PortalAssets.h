@@ -0,0 +1,251 @@
+// =============================
+// File: web/PortalAssets.h
+// =============================
+// tools/embed_assets.py 가 생성한 파일입니다. 직접 수정하지 말고 web/ 원본을 고친 뒤 다시 생성하세요.
+#pragma once
+#include <Arduino.h>
+
+namespace web {
+	struct Asset {
+		const char*    type;   // Content-Type
+		const uint8_t* gz;     // gzip 본문 (PROGMEM)
+		size_t         len;
+		const char*    etag;   // 따옴표 포함
+	};
+
+	// web/index.html (6759 → 2525 bytes)
+	static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+		0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x58, 0xed, 0x4f, 0x1b, 0xc9,
+		0x19, 0xff, 0xce, 0x5f, 0xf1, 0x74, 0xaf, 0x0d, 0xb6, 0x6a, 0xaf, 0xd7, 0x26, 0x10, 0x8a, 0xb1,
+		0xa5, 0x4b, 0x42, 0x9a, 0xa8, 0x41, 0xe1, 0x80, 0xb4, 0xea, 0x27, 0x32, 0xde, 0x1d, 0xdb, 0x73,
+		0xec, 0x5b, 0x77, 0xc6, 0x80, 0x93, 0x43, 0xca, 0xe9, 0x48, 0xc5, 0xe5, 0xa5, 0x4a, 0x2f, 0xc7,
+		0x25, 0x6a, 0x48, 0x4a, 0x24, 0xd2, 0xa8, 0xd5, 0x49, 0xa5, 0x39, 0xae, 0x4a, 0xd4, 0xf6, 0x9f,
+		0xe9, 0x47, 0xbc, 0xfc, 0x0f, 0x7d, 0x66, 0x76, 0xd7, 0xac, 0x8d, 0x31, 0xe4, 0xaa, 0xaa, 0x89,
+		0xb2, 0xb0, 0xb3, 0xf3, 0xfc, 0x9e, 0xdf, 0x3c, 0xef, 0x93, 0xe9, 0x1f, 0x5d, 0xbe, 0x71, 0x69,
+		0xf1, 0xd7, 0x73, 0x33, 0xd0, 0x14, 0x8e, 0x5d, 0x9d, 0x8e, 0x9f, 0x94, 0x58, 0xd5, 0x69, 0xc1,
+		0x84, 0x4d, 0xab, 0x0b, 0xd4, 0xe5, 0x5e, 0x70, 0xb5, 0x55, 0x83, 0x4b, 0x9e, 0x5b, 0x67, 0x8d,
+		0xe9, 0x42, 0xb4, 0x3e, 0x32, 0xed, 0x50, 0x41, 0xc0, 0x6c, 0x92, 0x80, 0x53, 0x51, 0xd1, 0x5a,
+		0xa2, 0x9e, 0x9f, 0xd4, 0x92, 0x65, 0x97, 0x38, 0xb4, 0xa2, 0xad, 0x30, 0xba, 0xea, 0x7b, 0x81,
+		0xd0, 0xc0, 0xf4, 0x5c, 0x41, 0x5d, 0xdc, 0xb6, 0xca, 0x2c, 0xd1, 0xac, 0x58, 0x74, 0x85, 0x99,
+		0x34, 0xaf, 0x5e, 0x72, 0xc0, 0x5c, 0x26, 0x18, 0xb1, 0xf3, 0xdc, 0x24, 0x36, 0xad, 0x14, 0x25,
+		0x08, 0x17, 0x6d, 0xa9, 0xa3, 0xe6, 0x59, 0x6d, 0xb8, 0x03, 0x75, 0x94, 0xce, 0xd7, 0x89, 0xc3,
+		0xec, 0xf6, 0x14, 0xe4, 0x89, 0xef, 0xdb, 0x34, 0xcf, 0xdb, 0x5c, 0x50, 0x27, 0x07, 0x17, 0x6d,
+		0xe6, 0x2e, 0xcf, 0x12, 0x73, 0x41, 0xbd, 0x5f, 0xc1, 0x9d, 0x39, 0xd0, 0x16, 0x68, 0xc3, 0xa3,
+		0x70, 0xf3, 0x9a, 0x96, 0x83, 0x79, 0xaf, 0xe6, 0x09, 0x2f, 0x07, 0x57, 0xa9, 0xbd, 0x42, 0x05,
+		0x33, 0x49, 0x0e, 0x3e, 0x0e, 0x50, 0x5b, 0x0e, 0x38, 0x71, 0x79, 0x9e, 0xd3, 0x80, 0xd5, 0xcb,
+		0x50, 0x23, 0xe6, 0x72, 0x23, 0xf0, 0x5a, 0xae, 0x95, 0x37, 0x3d, 0xdb, 0x0b, 0xa6, 0xe0, 0xa3,
+		0xfa, 0xf9, 0xfa, 0x44, 0x7d, 0xb2, 0x0c, 0xc9, 0xfb, 0xd8, 0xd8, 0x58, 0x19, 0x1c, 0x12, 0x34,
+		0x98, 0x3b, 0x05, 0x46, 0x19, 0x7c, 0x62, 0x59, 0xcc, 0x6d, 0x4c, 0x41, 0xc9, 0xf0, 0xd7, 0xca,
+		0x60, 0x31, 0xee, 0xdb, 0x04, 0xf9, 0xd5, 0x6d, 0x8a, 0xaf, 0x9f, 0xb6, 0xb8, 0x60, 0xf5, 0x76,
+		0x3e, 0x3e, 0xf8, 0x14, 0x98, 0xf8, 0xa4, 0x41, 0x19, 0x88, 0xcd, 0x1a, 0x6e, 0x9e, 0x21, 0x57,
+		0x7e, 0xb4, 0xe8, 0x30, 0x37, 0xdf, 0xa4, 0xac, 0xd1, 0xc4, 0x8d, 0x45, 0xc3, 0x58, 0x69, 0x96,
+		0x61, 0x7d, 0x44, 0x97, 0xb2, 0x84, 0xb9, 0x34, 0x40, 0x13, 0x0c, 0x22, 0x58, 0xaf, 0xa7, 0x58,
+		0x8c, 0x29, 0x16, 0x35, 0x2f, 0xb0, 0x68, 0x90, 0x0f, 0x88, 0xc5, 0x5a, 0x88, 0x3f, 0x19, 0xad,
+		0xad, 0xe5, 0x79, 0x93, 0x58, 0xde, 0x2a, 0xf2, 0x86, 0xf3, 0xfe, 0x1a, 0x14, 0x4b, 0xf8, 0x08,
+		0x1a, 0x35, 0x92, 0x31, 0x72, 0xea, 0xaf, 0x5e, 0xcc, 0xca, 0xb3, 0xad, 0x45, 0x1e, 0x99, 0x82,
+		0xf3, 0x86, 0x42, 0x8b, 0xdf, 0x90, 0xd1, 0x4f, 0x24, 0xa1, 0x66, 0x31, 0x07, 0xcd, 0x12, 0x92,
+		0x49, 0x18, 0x14, 0x49, 0x69, 0x5c, 0x5a, 0x45, 0xd0, 0x35, 0x91, 0x57, 0x07, 0x3b, 0x3a, 0x52,
+		0xcc, 0x04, 0x8d, 0x2f, 0x3c, 0x07, 0x31, 0x50, 0x23, 0xf7, 0x6c, 0x66, 0xc1, 0x47, 0x94, 0xd2,
+		0x2e, 0xef, 0xa3, 0xef, 0x4a, 0x61, 0x64, 0xde, 0xee, 0x62, 0x64, 0x59, 0xa9, 0x38, 0x09, 0x02,
+		0xce, 0x6e, 0x53, 0xdc, 0xac, 0x4f, 0x52, 0x47, 0x7d, 0x28, 0xf5, 0x7f, 0x28, 0xc9, 0x0f, 0x31,
+		0x8c, 0xf0, 0xfc, 0xc4, 0x2e, 0xeb, 0x23, 0x3e, 0xee, 0x1c, 0xc4, 0x33, 0xbd, 0x37, 0x3f, 0x90,
+		0x45, 0x84, 0x90, 0x9c, 0x79, 0x72, 0x72, 0x52, 0xc2, 0xd9, 0xa4, 0x46, 0x6d, 0x84, 0xec, 0xba,
+		0xbd, 0x66, 0x7b, 0xe6, 0x72, 0x2f, 0x5c, 0x71, 0x5c, 0x0a, 0x2a, 0x7a, 0xab, 0xb1, 0x73, 0x6b,
+		0x9e, 0x6d, 0x95, 0xd3, 0x8c, 0x0d, 0xfd, 0x67, 0xd1, 0x51, 0x98, 0xeb, 0xb7, 0x04, 0x02, 0xf6,
+		0xd8, 0xbc, 0xeb, 0x5d, 0xe9, 0xb1, 0x5e, 0xf0, 0xf1, 0x23, 0x77, 0xf7, 0x58, 0xd7, 0x34, 0xcd,
+		0x63, 0x61, 0x70, 0xbe, 0x1b, 0x06, 0xec, 0xb6, 0x82, 0xeb, 0x3a, 0x47, 0x99, 0x46, 0xaf, 0x09,
+		0x37, 0x9f, 0x0e, 0xb6, 0xbe, 0x58, 0x6e, 0x10, 0xbf, 0xcf, 0x41, 0x3d, 0x96, 0xad, 0xb5, 0xd0,
+		0x4e, 0xee, 0xe0, 0x18, 0x35, 0x8c, 0x0b, 0x44, 0x86, 0x69, 0xfc, 0xbe, 0xda, 0xc4, 0xc0, 0x4f,
+		0x1f, 0x4b, 0x46, 0x63, 0xc9, 0x48, 0x1f, 0xc5, 0xf5, 0x5c, 0x3a, 0xf8, 0x00, 0x66, 0x2b, 0xe0,
+		0x12, 0xc4, 0xf7, 0x58, 0xe4, 0xba, 0x1e, 0x53, 0xa5, 0xa3, 0x40, 0x5a, 0x74, 0x80, 0xd9, 0x13,
+		0xaa, 0x53, 0x4d, 0x6f, 0xe5, 0xa4, 0xa4, 0x32, 0x8c, 0xf1, 0x89, 0xda, 0xd8, 0xd1, 0x5e, 0x9d,
+		0x53, 0xb4, 0x8c, 0x45, 0x82, 0xf6, 0xe0, 0xfd, 0x13, 0xe6, 0x85, 0xf1, 0x0b, 0xd6, 0xa0, 0xfd,
+		0xc3, 0xb4, 0x8c, 0x93, 0x89, 0xd2, 0x84, 0x8a, 0x23, 0x92, 0x4a, 0xa7, 0xc4, 0x58, 0x2a, 0x4c,
+		0x2d, 0xc4, 0x09, 0x88, 0x60, 0x48, 0x37, 0xb6, 0x49, 0x7f, 0xa8, 0x9d, 0x16, 0xcd, 0x49, 0xf6,
+		0x4c, 0x17, 0xe2, 0x6a, 0x3a, 0x5d, 0x88, 0x0a, 0xbb, 0xac, 0xaa, 0xf8, 0x66, 0xb1, 0x15, 0x30,
+		0x6d, 0xc2, 0x79, 0x45, 0xeb, 0x3a, 0x5f, 0xd6, 0xde, 0xba, 0x17, 0x38, 0x40, 0x4c, 0xa9, 0xba,
+		0xa2, 0x15, 0x38, 0x59, 0xa1, 0x1a, 0x60, 0x51, 0x6f, 0x7a, 0x56, 0x45, 0x9b, 0xbb, 0xb1, 0xb0,
+		0x28, 0xf7, 0x34, 0x8b, 0xc7, 0x1a, 0x43, 0x2b, 0x62, 0x8b, 0x4a, 0x8a, 0x72, 0x43, 0xa9, 0xfa,
+		0x2b, 0x76, 0x85, 0xc1, 0x02, 0x15, 0x02, 0x5d, 0xcd, 0x71, 0xb9, 0x84, 0xcb, 0x51, 0xda, 0xa0,
+		0x86, 0x8a, 0xc6, 0x39, 0xb3, 0xb4, 0xea, 0xc2, 0xc2, 0xb5, 0xcb, 0xd3, 0x05, 0xb5, 0x8c, 0x9f,
+		0xa3, 0x24, 0x10, 0x6d, 0x1f, 0x9b, 0x87, 0x3c, 0x9e, 0x06, 0xcc, 0x8a, 0x77, 0xc6, 0x2d, 0x25,
+		0x92, 0xea, 0x01, 0xf2, 0xf1, 0x08, 0x5a, 0x75, 0x0e, 0x9f, 0xab, 0x18, 0x35, 0x83, 0xc1, 0xfc,
+		0xf8, 0x6b, 0x04, 0xa8, 0x24, 0x62, 0xc0, 0x48, 0x5a, 0x11, 0x9e, 0xfd, 0x64, 0x71, 0x71, 0x08,
+		0xe1, 0xa6, 0xc7, 0x85, 0x56, 0xbd, 0x18, 0x78, 0xcb, 0xe8, 0xd6, 0xab, 0xf8, 0x72, 0x1a, 0x6f,
+		0x25, 0x10, 0xab, 0x89, 0x84, 0x7b, 0x79, 0xcb, 0xce, 0x58, 0x9d, 0xc3, 0xe7, 0x60, 0x20, 0xb7,
+		0xe5, 0xd4, 0xd0, 0x23, 0x11, 0x63, 0xd5, 0x45, 0x63, 0xc6, 0x4a, 0xae, 0x07, 0xaa, 0xc5, 0xa5,
+		0xeb, 0x6e, 0xe2, 0x13, 0x32, 0x9e, 0x2f, 0xdd, 0x40, 0xec, 0xec, 0x69, 0xf4, 0x94, 0x50, 0x8c,
+		0x19, 0x01, 0xf4, 0x60, 0x3a, 0x4b, 0xbd, 0x86, 0x3d, 0x15, 0xb9, 0xd7, 0xc6, 0xb1, 0x78, 0x8c,
+		0x9f, 0x80, 0xf5, 0x68, 0xa8, 0x11, 0x61, 0x36, 0x97, 0x96, 0x31, 0x08, 0x88, 0x83, 0x2d, 0x9d,
+		0x83, 0x8f, 0xfc, 0x67, 0x29, 0xe7, 0xa4, 0x41, 0x21, 0x53, 0x84, 0x0a, 0x06, 0x3e, 0xa8, 0x4d,
+		0xe8, 0x90, 0xec, 0xe9, 0x46, 0x4a, 0xf0, 0x62, 0x9d, 0xdd, 0x57, 0xec, 0xae, 0x15, 0xad, 0x38,
+		0x50, 0xb9, 0x83, 0x9c, 0x66, 0xc9, 0x1a, 0x5c, 0x94, 0x6f, 0x70, 0x99, 0x62, 0x7e, 0x41, 0xc6,
+		0xe1, 0x67, 0x56, 0xe6, 0xf0, 0x5e, 0x6d, 0xf2, 0x3d, 0x52, 0x67, 0x18, 0x9a, 0xec, 0xa8, 0x15,
+		0x6d, 0xc2, 0xc0, 0x3f, 0x71, 0x84, 0x45, 0x39, 0x03, 0x97, 0x30, 0x6b, 0x6b, 0xdd, 0x74, 0x91,
+		0x61, 0xe6, 0x57, 0xe7, 0x6c, 0x62, 0x52, 0x10, 0x4d, 0x0a, 0xd1, 0x70, 0x84, 0x53, 0x11, 0x66,
+		0x27, 0x25, 0x2e, 0x10, 0x16, 0x40, 0x8d, 0x22, 0x69, 0x0a, 0x66, 0x22, 0xe8, 0x36, 0xf4, 0xe9,
+		0x82, 0x8f, 0x82, 0x71, 0xf1, 0x8d, 0xf8, 0x45, 0x2f, 0x11, 0x3f, 0xb5, 0xf5, 0xa2, 0xc0, 0xb7,
+		0x38, 0xc7, 0xbb, 0x85, 0x49, 0xab, 0x26, 0xfa, 0x29, 0xcc, 0x7e, 0x92, 0x2f, 0xc1, 0xbc, 0x31,
+		0x5d, 0x88, 0x44, 0x25, 0x93, 0x23, 0xe9, 0x25, 0x2e, 0x88, 0x68, 0xa1, 0x85, 0x62, 0x55, 0xc1,
+		0xa9, 0xfa, 0x16, 0x1c, 0x4c, 0x8e, 0x53, 0x95, 0x2e, 0xcc, 0xde, 0xf8, 0xc5, 0x0c, 0x94, 0xe0,
+		0x63, 0xdb, 0x6f, 0x92, 0x93, 0x54, 0x4b, 0xa4, 0x3e, 0x02, 0x68, 0xa9, 0x94, 0xe5, 0xe0, 0x52,
+		0x2b, 0x58, 0xa1, 0xbc, 0x6b, 0x40, 0xd5, 0x14, 0xfc, 0xb2, 0xed, 0x2d, 0xad, 0xe5, 0xf0, 0xd1,
+		0x2e, 0x37, 0x19, 0xfe, 0x86, 0x8f, 0x76, 0x19, 0x3d, 0x92, 0x43, 0x5f, 0x94, 0xd7, 0xa6, 0x4c,
+		0x23, 0x67, 0x16, 0x73, 0xba, 0xae, 0xcb, 0xd3, 0xcc, 0x38, 0xbe, 0x68, 0x63, 0x94, 0x2d, 0x53,
+		0xea, 0xe3, 0xd0, 0x68, 0xd1, 0x3a, 0x69, 0xd9, 0x98, 0x1c, 0x15, 0xa8, 0xb5, 0x98, 0x2d, 0xf2,
+		0xcc, 0x8d, 0xf4, 0xa6, 0xa2, 0x06, 0xc9, 0x2d, 0x99, 0x1e, 0x1e, 0xe6, 0x06, 0x64, 0x7e, 0x09,
+		0xe7, 0x02, 0x12, 0x60, 0xd1, 0xf5, 0x7d, 0xe7, 0xd4, 0x64, 0x8b, 0x05, 0xe3, 0x60, 0x49, 0x60,
+		0x8e, 0x61, 0x3b, 0xbf, 0x29, 0x61, 0x40, 0x4a, 0xa7, 0x64, 0xe6, 0x79, 0x61, 0xde, 0xf8, 0x50,
+		0x15, 0x52, 0x3e, 0xa5, 0x43, 0xc1, 0xf5, 0x54, 0xfa, 0x9e, 0x56, 0xaf, 0xf5, 0x3b, 0x94, 0xb7,
+		0x6a, 0x0e, 0x13, 0x32, 0x21, 0x57, 0x28, 0x9c, 0x83, 0x79, 0x5a, 0xf3, 0x3c, 0x91, 0xf2, 0x50,
+		0x01, 0x91, 0x22, 0x47, 0x5c, 0x67, 0xb8, 0x23, 0x0e, 0xe7, 0x05, 0xe5, 0xa5, 0xc4, 0x11, 0x51,
+		0xc9, 0x56, 0x4b, 0x4b, 0x24, 0xa0, 0x44, 0xab, 0x5e, 0xf7, 0x88, 0x6c, 0xf7, 0xd2, 0xea, 0xc3,
+		0x63, 0x16, 0x77, 0x5b, 0x27, 0x44, 0xcf, 0x3c, 0x7e, 0x02, 0x49, 0xcb, 0x4a, 0xd1, 0x21, 0xd0,
+		0x0c, 0x68, 0x1d, 0x9b, 0x54, 0xcb, 0xb7, 0x30, 0xb0, 0xb4, 0xea, 0xcf, 0x3d, 0x10, 0x1e, 0x5c,
+		0x61, 0x81, 0xb3, 0x8a, 0xaa, 0xe1, 0xa6, 0x5a, 0x9e, 0x2e, 0x10, 0x49, 0x5d, 0xb6, 0xb5, 0xe4,
+		0x08, 0x88, 0x21, 0x7b, 0x20, 0x52, 0x96, 0xf7, 0x1d, 0xbc, 0x6e, 0x98, 0x01, 0xf3, 0x45, 0x75,
+		0xa4, 0x50, 0x80, 0xc3, 0xdf, 0x3d, 0x0b, 0x5f, 0xec, 0x87, 0x6f, 0xee, 0x76, 0xee, 0x7f, 0x0d,
+		0x87, 0x5f, 0x3f, 0xec, 0xbc, 0x7c, 0x16, 0x3e, 0xd8, 0x0e, 0x9f, 0x3e, 0x86, 0x83, 0xef, 0x76,
+		0xc2, 0x9d, 0xad, 0x4c, 0xe3, 0x36, 0xf3, 0xb3, 0x9d, 0xc7, 0xcf, 0xc2, 0x6f, 0xf6, 0x21, 0x7c,
+		0xb9, 0x89, 0xab, 0x39, 0x08, 0x77, 0xee, 0x86, 0x2f, 0x5f, 0x77, 0x1e, 0x6f, 0x43, 0xb8, 0xb1,
+		0x8b, 0x9b, 0xe0, 0x60, 0xef, 0xab, 0xf0, 0xc5, 0x5d, 0x28, 0xc8, 0x13, 0x99, 0xaa, 0x3d, 0x22,
+		0x42, 0xb8, 0xb1, 0x0d, 0x9d, 0xbd, 0xe7, 0xe1, 0xd6, 0x06, 0x84, 0x7f, 0xdb, 0x08, 0x9f, 0x7f,
+		0xde, 0x79, 0xb0, 0xd9, 0x79, 0xb0, 0xab, 0x4b, 0xb5, 0x07, 0xdf, 0x3f, 0x56, 0x72, 0xdf, 0xbd,
+		0x0a, 0x37, 0x76, 0xa4, 0xa8, 0xd6, 0x79, 0xbf, 0x11, 0xfe, 0x61, 0xaf, 0xf3, 0x67, 0xd4, 0xb2,
+		0xbd, 0x83, 0x7c, 0x34, 0xa4, 0xd5, 0xf9, 0xeb, 0xdd, 0xce, 0x2b, 0x54, 0xf2, 0x16, 0x39, 0x3e,
+		0x44, 0x44, 0xc9, 0xd1, 0x97, 0x85, 0xa3, 0x89, 0x03, 0x0e, 0x0d, 0xf0, 0x5b, 0xe7, 0xcd, 0x43,
+		0xe8, 0x7c, 0xb7, 0x1f, 0x3e, 0xfd, 0x16, 0xc2, 0xdd, 0x47, 0x89, 0x82, 0x7a, 0xcb, 0x55, 0xfd,
+		0x1c, 0x6c, 0x74, 0x45, 0xd4, 0xae, 0x33, 0x75, 0x66, 0xdb, 0x51, 0x0a, 0x65, 0xe1, 0xce, 0x48,
+		0x40, 0x45, 0x2b, 0x70, 0xa1, 0x4e, 0xb1, 0x8a, 0x65, 0x46, 0x53, 0xbc, 0x47, 0xb3, 0x23, 0x3a,
+		0x56, 0x25, 0x37, 0x13, 0x50, 0xee, 0x7b, 0x2e, 0xa7, 0x50, 0xa9, 0x42, 0xf2, 0xbb, 0xfe, 0x29,
+		0xf7, 0xdc, 0x4c, 0x36, 0xd9, 0x82, 0xd6, 0x26, 0xf2, 0xf3, 0x9d, 0x11, 0xcb, 0x33, 0x5b, 0x0e,
+		0xce, 0x24, 0x7a, 0x83, 0x8a, 0x19, 0x9b, 0xca, 0x5f, 0x2f, 0xb6, 0xaf, 0x59, 0x99, 0x51, 0xd9,
+		0xbf, 0x47, 0xb3, 0xfa, 0x0a, 0xb1, 0x5b, 0x88, 0x04, 0x52, 0x42, 0x97, 0x6b, 0xe5, 0x93, 0x45,
+		0x64, 0xeb, 0xec, 0x17, 0x91, 0x6b, 0x43, 0x44, 0x64, 0x8b, 0xec, 0x17, 0x91, 0x6b, 0x43, 0x44,
+		0x64, 0x07, 0xec, 0x17, 0x91, 0x6b, 0x43, 0x44, 0xe2, 0x06, 0x83, 0x52, 0x58, 0x5c, 0x12, 0x99,
+		0x78, 0x71, 0x49, 0xd6, 0x9b, 0xb3, 0x88, 0xf6, 0x28, 0x8c, 0x97, 0x4f, 0x15, 0x74, 0xf8, 0x60,
+		0x49, 0x87, 0x97, 0x55, 0x30, 0xa9, 0x28, 0x82, 0xc3, 0x7b, 0x8f, 0xc2, 0xfb, 0xbb, 0x87, 0xf7,
+		0xdf, 0x75, 0x5e, 0xff, 0x13, 0x30, 0x30, 0x3a, 0x4f, 0x76, 0x31, 0x8e, 0xa0, 0xf3, 0x97, 0x7f,
+		0x1c, 0x6e, 0x6d, 0xc3, 0xc1, 0xdb, 0x7f, 0x61, 0x7c, 0xc1, 0xe1, 0xd6, 0x46, 0xe7, 0xc9, 0xf6,
+		0xc1, 0x1e, 0xae, 0xbf, 0xc7, 0x30, 0x7b, 0x0c, 0xff, 0xfe, 0xed, 0x57, 0x18, 0xd7, 0xf7, 0x3a,
+		0x3b, 0xaf, 0xc3, 0xf7, 0xef, 0x64, 0x24, 0xca, 0x40, 0x7c, 0x8e, 0x51, 0xf5, 0xfb, 0x1d, 0xc8,
+		0x44, 0x81, 0x0e, 0x98, 0x11, 0x70, 0xf0, 0x6e, 0x2f, 0x7c, 0xb5, 0x9f, 0xe8, 0x8a, 0x62, 0x34,
+		0x7b, 0x32, 0xf1, 0xa8, 0xe4, 0x21, 0xed, 0x54, 0xbc, 0x26, 0xe4, 0xa3, 0x6f, 0xf0, 0xd9, 0x67,
+		0x30, 0x3a, 0x5a, 0x1e, 0x0e, 0x81, 0x15, 0xed, 0x64, 0x0c, 0xfc, 0x98, 0x80, 0xb0, 0x3a, 0xf4,
+		0x45, 0xf8, 0xe9, 0xcc, 0x7a, 0x0c, 0xfa, 0xc1, 0x9c, 0x8e, 0x49, 0xa7, 0xd8, 0xac, 0x4b, 0xaf,
+		0xc8, 0xb4, 0xdc, 0xda, 0x0c, 0x5f, 0x60, 0xf6, 0x6f, 0x6f, 0x1c, 0x6e, 0xed, 0xa7, 0xaa, 0x06,
+		0x9a, 0xb8, 0xb3, 0x77, 0xb7, 0xf3, 0x76, 0xf3, 0xf0, 0xd9, 0x3b, 0x99, 0xd3, 0x98, 0xb4, 0xd2,
+		0xc4, 0x9d, 0xbf, 0x6f, 0x76, 0xfe, 0xf8, 0x6d, 0xf8, 0x4c, 0xb9, 0x2d, 0xdc, 0xba, 0x1f, 0xd5,
+		0x1a, 0xe5, 0x9b, 0xd8, 0x6f, 0xca, 0xb3, 0xef, 0xd3, 0xb5, 0xe4, 0xe4, 0x9c, 0xc0, 0x92, 0x9a,
+		0xa2, 0x39, 0xf4, 0x54, 0xd1, 0xb8, 0xd6, 0xb7, 0x7b, 0x3d, 0x2b, 0x0f, 0x32, 0xcc, 0x12, 0x6a,
+		0xe0, 0x40, 0x29, 0xbc, 0xde, 0xcd, 0xac, 0xe0, 0x87, 0xeb, 0x8c, 0x0b, 0x8a, 0x7d, 0x06, 0x3f,
+		0xda, 0xcc, 0x5c, 0x1e, 0xcd, 0x41, 0x52, 0x88, 0x32, 0xd2, 0x23, 0x58, 0x60, 0xb8, 0x80, 0xa8,
+		0x55, 0xcc, 0xd8, 0xd2, 0x74, 0x43, 0xb1, 0xe3, 0x69, 0x60, 0x14, 0x69, 0x24, 0x32, 0x3a, 0x73,
+		0x11, 0x7e, 0x11, 0x5b, 0xa0, 0xe4, 0x78, 0x29, 0x35, 0x1d, 0xe9, 0x3a, 0xcc, 0xe1, 0xf4, 0x84,
+		0xe5, 0x6a, 0x95, 0x30, 0x01, 0xa4, 0xe6, 0x61, 0xc7, 0x1c, 0x33, 0x20, 0x6a, 0x29, 0x5c, 0xc7,
+		0xf3, 0x88, 0x26, 0xe3, 0x3a, 0x5e, 0xaa, 0x48, 0xcd, 0xa6, 0x16, 0xca, 0x8b, 0xa0, 0x45, 0xcb,
+		0x23, 0x49, 0x05, 0x4c, 0x46, 0x2d, 0x1a, 0xb9, 0x77, 0x58, 0x11, 0x94, 0x2d, 0x78, 0x50, 0x11,
+		0x1c, 0xc8, 0x52, 0x7e, 0x3e, 0xae, 0xbb, 0x4e, 0x6c, 0x4e, 0xa5, 0x89, 0x47, 0x30, 0x74, 0x24,
+		0x01, 0x1a, 0x04, 0xd8, 0x59, 0x15, 0x8c, 0x34, 0x93, 0x67, 0x53, 0x5d, 0x2d, 0x65, 0x46, 0x67,
+		0xe4, 0x8f, 0x29, 0xb4, 0xa5, 0x7a, 0x3f, 0xdd, 0x18, 0x58, 0xf5, 0xeb, 0x84, 0xa1, 0x9a, 0xae,
+		0x45, 0x04, 0x5e, 0x66, 0x49, 0x03, 0x27, 0x80, 0x41, 0x56, 0xe8, 0x32, 0x89, 0xfe, 0x0d, 0x77,
+		0x49, 0x32, 0xef, 0xfd, 0x0f, 0x7d, 0x9e, 0x9a, 0x03, 0xcf, 0xe4, 0xf9, 0x64, 0xba, 0x1c, 0x1c,
+		0x01, 0xa5, 0x1f, 0x14, 0x01, 0x8a, 0xc4, 0xff, 0x37, 0x08, 0x06, 0x9f, 0x3b, 0x99, 0xa4, 0xcd,
+		0xe3, 0xce, 0xfe, 0x2f, 0x5c, 0x1b, 0x8f, 0x61, 0x67, 0x77, 0x6a, 0x6a, 0xaa, 0x90, 0x26, 0x4c,
+		0x8c, 0x80, 0xdf, 0x90, 0x3b, 0xb1, 0x69, 0x20, 0x32, 0xa3, 0x6a, 0x76, 0x03, 0x55, 0x4f, 0x38,
+		0x34, 0xe5, 0x7c, 0x59, 0xa3, 0x34, 0x1a, 0x48, 0x54, 0x68, 0xc6, 0x97, 0x47, 0x0e, 0x72, 0x70,
+		0x73, 0x3d, 0x8c, 0x91, 0xa6, 0xb7, 0xea, 0xca, 0xc9, 0x58, 0x7a, 0xac, 0x15, 0x30, 0xd1, 0xd6,
+		0x47, 0xb3, 0xc7, 0x4d, 0x33, 0x3c, 0x3b, 0xe2, 0xa3, 0x76, 0xe7, 0x1f, 0xe5, 0xdb, 0x68, 0x5e,
+		0x55, 0xcc, 0x13, 0x5f, 0x27, 0x01, 0xf6, 0x43, 0x66, 0x9d, 0xb3, 0x87, 0x74, 0x6a, 0x2a, 0x96,
+		0xb1, 0x6c, 0xd3, 0x44, 0x2c, 0xf6, 0xe7, 0xad, 0xf8, 0x3a, 0x06, 0x19, 0x65, 0xad, 0xec, 0x14,
+		0xfc, 0xf8, 0x8e, 0x6a, 0x27, 0x58, 0x82, 0x96, 0x02, 0x43, 0x17, 0xde, 0x15, 0xb6, 0x46, 0xad,
+		0x8c, 0x91, 0x5d, 0x87, 0x73, 0x37, 0x1c, 0xda, 0x20, 0x65, 0x79, 0x8f, 0xb9, 0x95, 0xa4, 0x85,
+		0x82, 0xf9, 0x69, 0x17, 0x87, 0x43, 0x46, 0x8e, 0xe9, 0x7d, 0x30, 0xfc, 0xec, 0x30, 0xd1, 0x15,
+		0x64, 0x5e, 0xc6, 0x55, 0x2f, 0x86, 0x5c, 0xe9, 0xc2, 0x8c, 0x65, 0xd7, 0x8f, 0x8b, 0x4e, 0x37,
+		0x83, 0xaa, 0x8a, 0xce, 0xf8, 0x9a, 0x77, 0xec, 0x48, 0x51, 0x4e, 0x2d, 0x11, 0xf9, 0xb1, 0x0b,
+		0x75, 0x3e, 0xbb, 0x3e, 0x98, 0x49, 0x0c, 0xa5, 0xa8, 0xf4, 0x9f, 0x2a, 0x46, 0xea, 0x25, 0x75,
+		0x32, 0x92, 0x89, 0x17, 0xe9, 0x7e, 0x59, 0x2e, 0x17, 0xd3, 0x76, 0xb9, 0xd5, 0x5f, 0x69, 0xae,
+		0x2e, 0xce, 0x5e, 0x47, 0x0f, 0x1d, 0x81, 0x9d, 0x90, 0xa7, 0x67, 0xf3, 0x7d, 0x6f, 0x16, 0x5f,
+		0x51, 0x19, 0x2b, 0x6f, 0x2e, 0x32, 0x1b, 0x62, 0x1d, 0x7a, 0xb7, 0xe3, 0xa6, 0x67, 0x76, 0x99,
+		0xc1, 0xd9, 0x0f, 0x4e, 0x01, 0x4e, 0xc5, 0x35, 0x79, 0x3b, 0xc6, 0xec, 0xcb, 0xa4, 0x32, 0x20,
+		0x07, 0xe3, 0x86, 0x61, 0x64, 0xcb, 0x80, 0xc3, 0xc9, 0x78, 0xb8, 0xbf, 0xd9, 0x79, 0x23, 0x47,
+		0x08, 0x08, 0xbf, 0xf8, 0xfc, 0xf0, 0x0b, 0xbc, 0x64, 0x3c, 0xbd, 0xd7, 0x79, 0xb4, 0x87, 0x97,
+		0x0e, 0x1c, 0x20, 0x47, 0x7a, 0xf2, 0x46, 0x09, 0x74, 0xef, 0x49, 0x20, 0x6f, 0x1d, 0x4f, 0xb6,
+		0xd5, 0x4c, 0x18, 0xfe, 0xe9, 0x4b, 0xf5, 0xe3, 0xc1, 0xee, 0xe1, 0x37, 0x5f, 0xca, 0xff, 0x78,
+		0x8c, 0xef, 0x55, 0xff, 0x01, 0x67, 0xcc, 0x06, 0xf3, 0x67, 0x1a, 0x00, 0x00,
+	};
+	static const Asset INDEX_HTML = { "text/html", INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), "\"37bb6b8732f3f444\"" };
+
+	// web/update.html (2123 → 1081 bytes)
+	static const uint8_t UPDATE_HTML_GZ[] PROGMEM = {
+		0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x56, 0x59, 0x6f, 0xdb, 0x46,
+		0x10, 0x7e, 0xe7, 0xaf, 0x98, 0xb0, 0x08, 0x48, 0xb5, 0x22, 0x45, 0xd9, 0x4e, 0xe2, 0x4a, 0xa2,
+		0x80, 0xfa, 0x42, 0x02, 0x24, 0x48, 0x60, 0xbb, 0x40, 0x8b, 0xa2, 0x0f, 0x2b, 0xee, 0x50, 0xdc,
+		0x86, 0xdc, 0x65, 0x77, 0x97, 0x3a, 0x1a, 0xe8, 0xbf, 0x77, 0x96, 0x87, 0x65, 0xd7, 0x0e, 0x50,
+		0x08, 0xa2, 0xb4, 0x3b, 0xd7, 0x37, 0xdf, 0x1c, 0xd2, 0xe2, 0xd5, 0xd5, 0xe7, 0xcb, 0xfb, 0xdf,
+		0xbf, 0x5c, 0x43, 0x61, 0xab, 0x72, 0xb9, 0xe8, 0x9f, 0xc8, 0xf8, 0x72, 0x61, 0x85, 0x2d, 0x71,
+		0x79, 0x23, 0x74, 0xb5, 0x65, 0x1a, 0xe1, 0xd7, 0x9a, 0x33, 0x8b, 0x8b, 0x49, 0x77, 0xed, 0x2d,
+		0x2a, 0xb4, 0x0c, 0xb2, 0x82, 0x69, 0x83, 0x36, 0xf5, 0x1b, 0x9b, 0x47, 0xe7, 0xfe, 0x70, 0x2d,
+		0x59, 0x85, 0xa9, 0xbf, 0x11, 0xb8, 0xad, 0x95, 0xb6, 0x3e, 0x64, 0x4a, 0x5a, 0x94, 0xa4, 0xb6,
+		0x15, 0xdc, 0x16, 0x29, 0xc7, 0x8d, 0xc8, 0x30, 0x6a, 0x0f, 0x63, 0x10, 0x52, 0x58, 0xc1, 0xca,
+		0xc8, 0x64, 0xac, 0xc4, 0x74, 0xea, 0x9c, 0x18, 0xbb, 0x77, 0x31, 0x56, 0x8a, 0xef, 0xe1, 0x1b,
+		0xe4, 0x64, 0x1d, 0xe5, 0xac, 0x12, 0xe5, 0x7e, 0x06, 0x11, 0xab, 0xeb, 0x12, 0x23, 0xb3, 0x37,
+		0x16, 0xab, 0x31, 0x5c, 0x94, 0x42, 0x7e, 0xfd, 0xc4, 0xb2, 0xbb, 0xf6, 0x7c, 0x43, 0x9a, 0x63,
+		0xf0, 0xef, 0x70, 0xad, 0x08, 0xf0, 0x07, 0x7f, 0x0c, 0xb7, 0x6a, 0xa5, 0xac, 0x1a, 0xc3, 0x7b,
+		0x2c, 0x37, 0x68, 0x45, 0xc6, 0xc6, 0xf0, 0x8b, 0xa6, 0x68, 0x63, 0x30, 0x4c, 0x9a, 0xc8, 0xa0,
+		0x16, 0xf9, 0x1c, 0x56, 0x2c, 0xfb, 0xba, 0xd6, 0xaa, 0x91, 0x3c, 0xca, 0x54, 0xa9, 0xf4, 0x0c,
+		0x7e, 0xc8, 0xcf, 0xf2, 0xb7, 0xf9, 0xf9, 0x1c, 0x86, 0xf3, 0xe9, 0xe9, 0xe9, 0x1c, 0x2a, 0xa6,
+		0xd7, 0x42, 0xce, 0x20, 0x99, 0x43, 0xcd, 0x38, 0x17, 0x72, 0x3d, 0x83, 0x93, 0xa4, 0xde, 0xcd,
+		0x81, 0x0b, 0x53, 0x97, 0x8c, 0xf0, 0xe5, 0x25, 0xd2, 0xf1, 0xaf, 0xc6, 0x58, 0x91, 0xef, 0xa3,
+		0x3e, 0xf1, 0x19, 0x64, 0xf4, 0x44, 0x3d, 0x07, 0x56, 0x8a, 0xb5, 0x8c, 0x04, 0x61, 0x35, 0xc7,
+		0xcb, 0x4a, 0xc8, 0xa8, 0x40, 0xb1, 0x2e, 0x48, 0x71, 0x9a, 0x24, 0x9b, 0x62, 0x0e, 0x07, 0x2f,
+		0x76, 0xb6, 0x4c, 0x48, 0xd4, 0x44, 0xc1, 0x4b, 0x00, 0xf3, 0xfc, 0x11, 0x8a, 0xd3, 0x16, 0xc5,
+		0x4a, 0x69, 0x8e, 0x3a, 0xd2, 0x8c, 0x8b, 0x86, 0xfc, 0x9f, 0x77, 0x77, 0xbb, 0xc8, 0x14, 0x8c,
+		0xab, 0x2d, 0xe1, 0x86, 0xb3, 0x7a, 0x07, 0xd3, 0x13, 0x7a, 0xe8, 0xf5, 0x8a, 0x85, 0xc9, 0xb8,
+		0x7d, 0xc5, 0xd3, 0x91, 0xcb, 0x6d, 0xd7, 0x55, 0x64, 0x06, 0x67, 0x49, 0xeb, 0xad, 0x3f, 0x11,
+		0xa2, 0xd7, 0x73, 0xb0, 0xb8, 0xb3, 0x51, 0x8b, 0xfe, 0x88, 0xfb, 0xe0, 0x15, 0x53, 0x02, 0x37,
+		0x20, 0x9a, 0xb2, 0x93, 0x37, 0x8e, 0xa5, 0x83, 0x27, 0x64, 0xdd, 0xd8, 0x3f, 0xec, 0xbe, 0xc6,
+		0x34, 0x17, 0x25, 0xfe, 0x49, 0x4a, 0x03, 0x75, 0x8e, 0x2e, 0xc7, 0xdf, 0xc1, 0x5b, 0x35, 0xd6,
+		0x2a, 0xf9, 0xbd, 0xe4, 0x7e, 0x7e, 0x93, 0x24, 0x0f, 0xec, 0x6f, 0x0b, 0x62, 0xec, 0x51, 0xb6,
+		0x53, 0x97, 0xc6, 0xc9, 0xa3, 0x94, 0x67, 0x20, 0x95, 0xc4, 0x67, 0x04, 0x9c, 0x39, 0x8d, 0xac,
+		0xd1, 0xc6, 0x39, 0xa9, 0x95, 0xe8, 0x60, 0x3f, 0xc9, 0xab, 0x6d, 0x2e, 0x23, 0xfe, 0x41, 0xba,
+		0xc0, 0xaa, 0x3f, 0x6f, 0xfb, 0x62, 0xac, 0x54, 0xc9, 0x8f, 0x50, 0x67, 0x85, 0xda, 0x7c, 0xaf,
+		0x1a, 0xfc, 0xed, 0x3b, 0x4c, 0xda, 0xb4, 0xe2, 0x5a, 0xab, 0xb5, 0x46, 0x63, 0x48, 0xf1, 0x49,
+		0xa4, 0x97, 0xac, 0x38, 0x7f, 0x19, 0x73, 0xc7, 0x56, 0x64, 0x55, 0x3d, 0x34, 0x18, 0x39, 0x5e,
+		0x31, 0x7d, 0xf4, 0xe9, 0x3c, 0x0e, 0x3d, 0xd3, 0x33, 0xf1, 0xdc, 0x7f, 0x92, 0xbc, 0x63, 0xae,
+		0x4d, 0x5e, 0x0a, 0xf1, 0x52, 0x41, 0x9f, 0xd2, 0x4d, 0xa3, 0x85, 0xd1, 0xd3, 0x18, 0x07, 0x6f,
+		0x31, 0xe9, 0x86, 0x73, 0x31, 0xe9, 0xb6, 0x84, 0x9b, 0x51, 0x9a, 0x58, 0x2e, 0x36, 0x90, 0x95,
+		0xcc, 0x98, 0xd4, 0x7f, 0xe8, 0x5b, 0x37, 0xc9, 0xc5, 0xf4, 0xf9, 0x06, 0xa1, 0x3b, 0x6f, 0x91,
+		0x2b, 0x5d, 0x01, 0x2d, 0x8b, 0x42, 0xf1, 0xd4, 0xff, 0xf2, 0xf9, 0xee, 0xde, 0x07, 0x96, 0x59,
+		0xa1, 0x64, 0xea, 0x4f, 0x9a, 0x56, 0xd1, 0x07, 0x94, 0x59, 0xdb, 0x43, 0x7e, 0xd5, 0x94, 0x56,
+		0xd4, 0x4c, 0xdb, 0x89, 0x33, 0x8b, 0x48, 0xca, 0x9c, 0xf3, 0xb6, 0xcd, 0xa0, 0x53, 0x71, 0x7d,
+		0xe6, 0xf7, 0x8b, 0xa7, 0xb7, 0x27, 0x8d, 0xbe, 0xc7, 0x3a, 0x15, 0xd3, 0xac, 0x2a, 0x61, 0xfd,
+		0xe5, 0x80, 0xa3, 0x13, 0x92, 0x56, 0xeb, 0xf5, 0x69, 0x12, 0x43, 0x11, 0xfd, 0xe5, 0xe3, 0x5b,
+		0xaa, 0x80, 0x0f, 0x82, 0x1f, 0xc5, 0x17, 0x74, 0xb1, 0x4c, 0x5e, 0x2f, 0x26, 0xa4, 0xb4, 0xec,
+		0x9e, 0xde, 0xf0, 0x61, 0x32, 0x2d, 0x6a, 0xbb, 0xf4, 0xb8, 0xca, 0x9a, 0x8a, 0x08, 0x8e, 0xff,
+		0x6e, 0x50, 0xef, 0xef, 0xb0, 0xc4, 0xcc, 0x2a, 0x1d, 0x06, 0x2e, 0x68, 0x30, 0x8a, 0xa9, 0xa7,
+		0xaf, 0x37, 0x24, 0xfe, 0x28, 0x68, 0x83, 0x11, 0x6b, 0x61, 0xd0, 0xe1, 0x0c, 0xc6, 0x90, 0x37,
+		0xb2, 0xa5, 0x24, 0xc4, 0x11, 0x7c, 0xf3, 0x90, 0x3a, 0x0b, 0x9d, 0xe6, 0x15, 0xe6, 0x8c, 0x08,
+		0x09, 0x47, 0x73, 0x6f, 0x43, 0x2d, 0xe1, 0xfc, 0x5c, 0x11, 0x23, 0x90, 0x82, 0xc4, 0x2d, 0xdc,
+		0xf4, 0xc7, 0xd0, 0x16, 0xc2, 0xf4, 0x2a, 0xbb, 0x42, 0xf7, 0xd2, 0xdf, 0x3e, 0x7d, 0x7c, 0x6f,
+		0x6d, 0x7d, 0x8b, 0x04, 0xc6, 0xb4, 0x2e, 0x48, 0x16, 0xab, 0x1a, 0x65, 0x18, 0xb8, 0x2a, 0x50,
+		0xd4, 0xa0, 0xe7, 0x9f, 0xbe, 0x5a, 0xdd, 0x60, 0xaf, 0xd2, 0xd4, 0xa5, 0x62, 0xfc, 0x05, 0xb4,
+		0x03, 0x15, 0xcf, 0xf0, 0x8a, 0x1c, 0x42, 0x8c, 0x4b, 0x94, 0x6b, 0x5b, 0x5c, 0xaa, 0x8a, 0x4a,
+		0xc5, 0x56, 0x65, 0x2b, 0x71, 0x90, 0x6a, 0xd4, 0xae, 0xeb, 0x9c, 0xa0, 0x44, 0x8b, 0x04, 0xcf,
+		0x29, 0x53, 0x08, 0xe4, 0x30, 0x01, 0x8c, 0xad, 0xb2, 0xac, 0x1c, 0xc1, 0x8f, 0x6e, 0x78, 0xba,
+		0x24, 0x5c, 0xfb, 0xa7, 0xf0, 0xc0, 0xe6, 0x1a, 0xed, 0x75, 0x89, 0xee, 0xeb, 0xc5, 0xfe, 0x03,
+		0x3f, 0xe2, 0xa0, 0x92, 0x04, 0x84, 0x99, 0xb4, 0xe3, 0xb6, 0x53, 0xe3, 0x76, 0x60, 0xc8, 0xf2,
+		0x3f, 0x11, 0x29, 0xc2, 0x8d, 0xd8, 0x21, 0x0f, 0x4f, 0x46, 0xf0, 0x13, 0x04, 0xaf, 0x83, 0xce,
+		0xc6, 0x8d, 0xc5, 0x65, 0xb7, 0xb5, 0xff, 0x97, 0xcd, 0xc1, 0x3b, 0x0c, 0x24, 0x4a, 0x07, 0x9f,
+		0x8c, 0x1e, 0x68, 0x18, 0x58, 0x70, 0x52, 0x63, 0x99, 0x6d, 0x0c, 0xa4, 0x69, 0x4a, 0xa3, 0x94,
+		0x38, 0x09, 0xfd, 0xda, 0x69, 0x1b, 0x06, 0x5d, 0x37, 0xc2, 0x5d, 0x93, 0x65, 0x84, 0xfe, 0x15,
+		0xdc, 0xe2, 0x4a, 0x29, 0x4b, 0x6b, 0x2e, 0x8e, 0x63, 0x97, 0x08, 0xfd, 0xbc, 0xde, 0x8b, 0x0a,
+		0x55, 0x63, 0xc3, 0xa3, 0x63, 0xb7, 0x06, 0x24, 0xad, 0x74, 0x62, 0x2c, 0x63, 0xee, 0x2a, 0x2e,
+		0x34, 0xe6, 0x14, 0x3b, 0x98, 0x04, 0x34, 0xa5, 0x63, 0xc7, 0x5a, 0x42, 0xc6, 0x07, 0xc0, 0xd2,
+		0xe0, 0xb3, 0x60, 0x37, 0x8c, 0xa6, 0x85, 0xcf, 0x20, 0xa0, 0x2c, 0x1c, 0x38, 0xe2, 0xad, 0x56,
+		0xd2, 0xe0, 0x3d, 0x25, 0x3f, 0x6a, 0x73, 0xea, 0x52, 0x32, 0x28, 0x79, 0x38, 0xf4, 0x97, 0x13,
+		0xd0, 0x9b, 0x16, 0x40, 0xd7, 0xd8, 0x34, 0x40, 0x6e, 0xf6, 0x69, 0x9e, 0xdd, 0x9f, 0x06, 0xef,
+		0x5f, 0x3f, 0xdc, 0x85, 0xae, 0x4b, 0x08, 0x00, 0x00,
+	};
+	static const Asset UPDATE_HTML = { "text/html", UPDATE_HTML_GZ, sizeof(UPDATE_HTML_GZ), "\"2d528cb1a5ece8a1\"" };
+} // namespace web
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# =============================
+# File: tools/embed_assets.py
+# =============================
+"""설정 포털 정적 파일(web/) → gzip PROGMEM 헤더(src/web/PortalAssets.h) 생성기
+
+펌웨어는 이 헤더의 gzip 바이트를 플래시에서 그대로 전송하고(Content-Encoding: gzip),
+ETag(gzip 내용의 SHA-256 앞 16자리)로 If-None-Match 요청에 304를 돌려줍니다.
+web/ 아래 파일을 고친 뒤에는 반드시 다시 실행하고 생성된 헤더도 함께 커밋하세요.
+(Arduino IDE 빌드에는 사전 빌드 단계가 없으므로 생성물을 저장소에 둡니다.)
+
+사용 예:
+    python3 tools/embed_assets.py            # 저장소 루트 기준 기본 경로
+    python3 tools/embed_assets.py --check    # 헤더가 web/ 과 일치하는지만 확인 (CI용)
+
+출력은 입력이 같으면 항상 같습니다. (gzip mtime=0, 압축 수준 9)
+"""
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+# (원본 파일, C 식별자, Content-Type)
+ASSETS = [
+    ("web/index.html", "INDEX_HTML", "text/html"),
+    ("web/update.html", "UPDATE_HTML", "text/html"),
+]
+
+OUT = "src/web/PortalAssets.h"
+
+
+def minify(text):
+    """줄 앞 들여쓰기와 빈 줄만 제거 (HTML/CSS/JS 의미는 바뀌지 않음)"""
+    lines = (ln.strip() for ln in text.splitlines())
+    return "\n".join(ln for ln in lines if ln) + "\n"
+
+
+def compress(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(data, indent="\t\t"):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append(indent + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def render():
+    out = [
+        "// =============================",
+        "// File: web/PortalAssets.h",
+        "// =============================",
+        "// tools/embed_assets.py 가 생성한 파일입니다. 직접 수정하지 말고 web/ 원본을 고친 뒤 다시 생성하세요.",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "namespace web {",
+        "\tstruct Asset {",
+        "\t\tconst char*    type;   // Content-Type",
+        "\t\tconst uint8_t* gz;     // gzip 본문 (PROGMEM)",
+        "\t\tsize_t         len;",
+        "\t\tconst char*    etag;   // 따옴표 포함",
+        "\t};",
+    ]
+    summary = []
+    for src, name, ctype in ASSETS:
+        with open(os.path.join(ROOT, src), encoding="utf-8") as f:
+            raw = minify(f.read()).encode("utf-8")
+        gz = compress(raw)
+        etag = '"%s"' % hashlib.sha256(gz).hexdigest()[:16]
+        summary.append((src, len(raw), len(gz)))
+        out += [
+            "",
+            "\t// %s (%d → %d bytes)" % (src, len(raw), len(gz)),
+            "\tstatic const uint8_t %s_GZ[] PROGMEM = {" % name,
+            c_array(gz),
+            "\t};",
+            "\tstatic const Asset %s = { \"%s\", %s_GZ, sizeof(%s_GZ), \"\\\"%s\\\"\" };"
+            % (name, ctype, name, name, etag.strip('"')),
+        ]
+    out += ["} // namespace web", ""]
+    return "\n".join(out), summary
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--check", action="store_true", help="생성 결과가 현재 헤더와 다르면 종료 코드 1")
+    args = ap.parse_args()
+
+    text, summary = render()
+    path = os.path.join(ROOT, OUT)
+    if args.check:
+        try:
+            with open(path, encoding="utf-8") as f:
+                same = f.read() == text
+        except FileNotFoundError:
+            same = False
+        if not same:
+            print("%s is out of date; run tools/embed_assets.py" % OUT, file=sys.stderr)
+            return 1
+        return 0
+
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    for src, n_raw, n_gz in summary:
+        print("%-18s %6d -> %5d bytes" % (src, n_raw, n_gz))
+    print("wrote %s" % OUT)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
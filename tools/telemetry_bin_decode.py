@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# =============================
+# File: tools/telemetry_bin_decode.py
+# =============================
+"""sensorhub/telemetry/bin 레코드 디코더 (수집 서버용)
+
+레코드 형식은 src/core/TelemetryBin.h 참고. 필드 테이블은 src/core/Telemetry.cpp의
+FIELDS와 같은 순서여야 합니다. (펌웨어에서 필드를 추가하면 여기에도 끝에 추가)
+
+사용 예:
+    python3 telemetry_bin_decode.py --hex A7011800...
+    python3 telemetry_bin_decode.py record1.bin record2.bin
+    python3 telemetry_bin_decode.py --mqtt 192.168.0.186 [--port 1883]   # paho-mqtt 필요
+
+sensorhub/telemetry/bin/replay 페이로드는 레코드 여러 개를 그대로 이어 붙인 것이며,
+decode_all()이 mask와 배열 필드의 원소 수로 레코드 길이를 계산해 나눕니다.
+"""
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0xA7
+HEADER = struct.Struct("<BBBBII")
+
+# (key, kind, digits) — kind: "f" = float32, "u" = uint32, "v" = uint32 원소 수 k + float32 * k
+FIELDS_V1 = [
+    ("pm1_0", "f", 2), ("pm2_5", "f", 2), ("pm4_0", "f", 2), ("pm10", "f", 2),
+    ("temp", "f", 2), ("hum", "f", 2), ("gas_kohm", "f", 3),
+    ("smk_blue", "u", 0), ("smk_ir", "u", 0), ("smk_ratio", "f", 3), ("smk_alpha", "f", 3),
+    ("smk_score", "f", 0), ("smk_alarm", "u", 0),
+    ("eCO2_ppm", "u", 0), ("TVOC_ppb", "u", 0),
+    ("CO_V", "f", 2), ("CO_ppm", "f", 2),
+    ("mq2_mV", "f", 2), ("mq2_Rs", "f", 0), ("mq2_ratio", "f", 2), ("mq2_ema", "f", 2),
+    ("Smoke_mV", "f", 2),
+    ("mic_rms", "f", 0),
+    ("ZE07_CO_ppm", "f", 1),
+]
+
+# v2: gas_fp (BME688 히터 프로파일 스캔 벡터) 추가
+FIELDS_V2 = FIELDS_V1 + [
+    ("gas_fp", "v", 2),
+]
+
+# v3: mq2_ppm (교정 곡선 기반 MQ-2 농도) 추가
+FIELDS_V3 = FIELDS_V2 + [
+    ("mq2_ppm", "f", 1),
+]
+
+# v4: 마이크 피크/A가중 Leq 추가
+FIELDS_V4 = FIELDS_V3 + [
+    ("mic_peak", "f", 0), ("mic_laeq", "f", 1), ("mic_laeq_long", "f", 1),
+]
+
+# v5: awake_ms (저전력 모드 sensorTask 작업 시간) 추가
+FIELDS_V5 = FIELDS_V4 + [
+    ("awake_ms", "u", 0),
+]
+
+SCHEMAS = {1: FIELDS_V1, 2: FIELDS_V2, 3: FIELDS_V3, 4: FIELDS_V4, 5: FIELDS_V5}
+
+
+def _decode(buf):
+    """레코드 1개를 (dict, 레코드 길이)로 변환. 형식 오류 시 ValueError."""
+    if len(buf) < HEADER.size:
+        raise ValueError("record too short")
+    magic, version, count, _flags, mask, ts = HEADER.unpack_from(buf, 0)
+    if magic != MAGIC:
+        raise ValueError("bad magic 0x%02X" % magic)
+    fields = SCHEMAS.get(version)
+    if fields is None:
+        raise ValueError("unknown version %d" % version)
+    if count > len(fields):
+        # 펌웨어가 더 새로운 필드를 가진 경우: 아는 필드까지만 디코딩
+        sys.stderr.write("warning: record has %d fields, decoder knows %d\n" % (count, len(fields)))
+
+    out = {}
+    if ts:
+        out["ts"] = ts
+    off = HEADER.size
+    for i in range(count):
+        if not (mask >> i) & 1:
+            continue
+        if i >= len(fields):
+            # 모르는 필드는 4바이트 스칼라로 가정
+            off += 4
+            continue
+        key, kind, digits = fields[i]
+        if off + 4 > len(buf):
+            raise ValueError("truncated at field %d" % i)
+        if kind == "u":
+            out[key] = struct.unpack_from("<I", buf, off)[0]
+            off += 4
+        elif kind == "v":
+            n = struct.unpack_from("<I", buf, off)[0]
+            off += 4
+            if off + 4 * n > len(buf):
+                raise ValueError("truncated in array field %d" % i)
+            out[key] = [round(x, digits) for x in struct.unpack_from("<%df" % n, buf, off)]
+            off += 4 * n
+        else:
+            out[key] = round(struct.unpack_from("<f", buf, off)[0], digits)
+            off += 4
+    return out, off
+
+
+def record_size(buf, off=0):
+    """off에서 시작하는 레코드의 전체 길이 (헤더 + 필드 값, 배열 필드는 원소 수만큼)"""
+    return _decode(buf[off:])[1]
+
+
+def decode(buf):
+    """바이너리 레코드 1개를 dict로 변환. 형식 오류 시 ValueError."""
+    return _decode(buf)[0]
+
+
+def decode_all(buf):
+    """이어 붙은 레코드들(재전송 묶음)을 dict 리스트로 변환."""
+    out = []
+    off = 0
+    while off < len(buf):
+        n = record_size(buf, off)
+        out.append(decode(buf[off:off + n]))
+        off += n
+    return out
+
+
+def _mqtt(host, port, topic):
+    import paho.mqtt.client as mqtt  # 선택 의존성
+
+    def on_message(_c, _u, msg):
+        try:
+            for rec in decode_all(msg.payload):
+                print(json.dumps(rec))
+        except ValueError as e:
+            sys.stderr.write("decode error: %s\n" % e)
+
+    c = mqtt.Client()
+    c.on_message = on_message
+    c.connect(host, port)
+    c.subscribe([(topic, 0), (topic + "/replay", 0)])
+    c.loop_forever()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("files", nargs="*", help="raw record files")
+    ap.add_argument("--hex", help="record as hex string")
+    ap.add_argument("--mqtt", metavar="HOST", help="subscribe to the broker and decode live")
+    ap.add_argument("--port", type=int, default=1883)
+    ap.add_argument("--topic", default="sensorhub/telemetry/bin")
+    args = ap.parse_args()
+
+    if args.mqtt:
+        _mqtt(args.mqtt, args.port, args.topic)
+        return
+    if args.hex:
+        for rec in decode_all(bytes.fromhex(args.hex)):
+            print(json.dumps(rec))
+    for path in args.files:
+        with open(path, "rb") as f:
+            for rec in decode_all(f.read()):
+                print(json.dumps(rec))
+
+
+if __name__ == "__main__":
+    main()